@@ -126,6 +126,11 @@ constexpr uint32_t MAX_APPLICATION_CAPRO_FIFO_SIZE = 128U;
 constexpr uint64_t SHARED_MEMORY_ALIGNMENT = 32U;
 constexpr uint32_t MAX_NUMBER_OF_MEMPOOLS = 32U;
 constexpr uint32_t MAX_SHM_SEGMENTS = 100U;
+/// upper limit for the number of chunk magazines of a mempool; the actual number is configured per mempool and only
+/// that number of magazine slots occupies shared memory. Further publishers allocate directly from the free list and
+/// retry to get a slot on subsequent allocations
+constexpr uint32_t MAX_CHUNK_MAGAZINES_PER_MEMPOOL = 16U;
+constexpr uint32_t CHUNK_MAGAZINE_CAPACITY = 32U;
 
 constexpr uint32_t MAX_NUMBER_OF_MEMORY_PROVIDER = 8U;
 constexpr uint32_t MAX_NUMBER_OF_MEMORY_BLOCKS_PER_MEMORY_PROVIDER = 64U;
@@ -0,0 +1,111 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef IOX_POSH_MEPOO_CHUNK_MAGAZINE_HPP
+#define IOX_POSH_MEPOO_CHUNK_MAGAZINE_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iceoryx_utils/internal/relocatable_pointer/relative_ptr.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace mepoo
+{
+/// @brief The ChunkMagazine is a small stash of chunks in front of the free list of a MemPool. It takes the chunks in
+/// batches from the MemPool and hands them out one by one without touching the head of the free list which is shared
+/// by all users of the MemPool. The stash itself lives in a slot of the MemPool, this way the MemPool reclaims stashed
+/// chunks when its free list runs empty and introspection reports them separately from used and free chunks.
+/// The ChunkMagazine is not thread safe, it is intended to be owned by a single entity like a ChunkSender which lives
+/// in shared memory so that RouDi is able to flush the magazine if the owning process terminates unexpectedly.
+/// Chunks handed out by the magazine are freed directly to the MemPool.
+/// A MemPool provides only as many slots as configured in its MePooConfig entry; a magazine without slot falls back
+/// to the free list and retries to acquire a slot on subsequent calls.
+/// @note the owner has to call flush before the ChunkMagazine is destroyed, the destructor does not touch the
+/// MemPool since it might already be gone when the ChunkMagazine is destroyed
+class ChunkMagazine
+{
+  public:
+    static constexpr uint32_t CAPACITY = CHUNK_MAGAZINE_CAPACITY;
+
+    ChunkMagazine() noexcept = default;
+    ChunkMagazine(const ChunkMagazine&) = delete;
+    ChunkMagazine(ChunkMagazine&&) = delete;
+    ChunkMagazine& operator=(const ChunkMagazine&) = delete;
+    ChunkMagazine& operator=(ChunkMagazine&&) = delete;
+    ~ChunkMagazine() noexcept = default;
+
+    /// @brief sets the number of chunks which are taken at once from the MemPool, already stashed chunks are flushed
+    /// @param[in] batchSize number of chunks, 0 disables the magazine, values larger than CAPACITY are reduced to
+    /// CAPACITY; the MemPool additionally limits a batch to a fraction of its chunks
+    void setBatchSize(const uint32_t batchSize) noexcept;
+
+    /// @brief returns the number of chunks which are taken at once from the MemPool, 0 if the magazine is disabled
+    uint32_t getBatchSize() const noexcept;
+
+    /// @brief returns a chunk from the given MemPool. If the magazine is disabled or there is no free slot in the
+    /// MemPool the chunk is taken directly from the MemPool. If the magazine was used for another MemPool before, the
+    /// chunks of that MemPool are flushed.
+    /// @param[in] memPool the MemPool from which the chunk shall be taken
+    /// @return pointer to the chunk or nullptr if the MemPool has no more chunks
+    void* getChunk(MemPool& memPool) noexcept;
+
+    /// @brief returns multiple chunks from the given MemPool. The stash is drained first, the remaining chunks are
+    /// taken with a batched pop from the free list of the MemPool
+    /// @param[in] memPool the MemPool from which the chunks shall be taken
+    /// @param[out] chunks memory for at least maxNumberOfChunks pointers
+    /// @param[in] maxNumberOfChunks the maximum number of chunks to take
+    /// @return the number of acquired chunks, less than maxNumberOfChunks if the MemPool has no more chunks
+    uint32_t getChunks(MemPool& memPool, void** const chunks, const uint32_t maxNumberOfChunks) noexcept;
+
+    /// @brief returns all stashed chunks to the MemPool and releases the slot of the MemPool, this is also used by
+    /// RouDi to clean up after the owner terminated unexpectedly
+    void flush() noexcept;
+
+    /// @brief returns the number of currently stashed chunks
+    uint32_t size() const noexcept;
+
+  private:
+    bool tryAcquireSlot() noexcept;
+
+    /// @brief the id under which the slot is registered in the MemPool; it is derived from the position of the
+    /// magazine in the shared memory and therefore the same in every process
+    uint64_t getOwnerId() const noexcept;
+
+    uint32_t m_batchSize{0u};
+    relative_ptr<MemPool> m_memPool;
+    bool m_hasSlot{false};
+    bool m_slotShortageReported{false};
+    uint32_t m_slot{0u};
+};
+
+/// @brief the magazines which are required to get chunks from a MemoryManager without touching the free lists on
+/// every allocation, one for each payload mempool and one for the chunk management
+struct ChunkMagazines
+{
+    /// @brief sets the batch size of all magazines, 0 disables them
+    void setBatchSize(const uint32_t batchSize) noexcept;
+
+    /// @brief returns the stashed chunks of all magazines to the MemPools
+    void flush() noexcept;
+
+    ChunkMagazine m_payload[MAX_NUMBER_OF_MEMPOOLS];
+    ChunkMagazine m_chunkManagement;
+};
+
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_CHUNK_MAGAZINE_HPP
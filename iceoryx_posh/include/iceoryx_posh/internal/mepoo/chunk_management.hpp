@@ -43,10 +43,19 @@ struct alignas(32) ChunkManagement
     {
     }
 
+    /// @brief creates a ChunkManagement which is stored in the same chunk as the ChunkHeader; the whole chunk is
+    /// returned to f_mempool when the reference counter drops to zero
+    ChunkManagement(const cxx::not_null<base_t*> f_chunkHeader, const cxx::not_null<MemPool*> f_mempool)
+        : m_chunkHeader(f_chunkHeader)
+        , m_mempool(f_mempool)
+    {
+    }
+
     iox::relative_ptr<base_t> m_chunkHeader;
     referenceCounter_t m_referenceCounter{1u};
     /// @todo optimization: check if this can be replaced by an offset relative to the this pointer
     iox::relative_ptr<MemPool> m_mempool;
+    /// nullptr if the ChunkManagement is located in the chunk of m_mempool
     iox::relative_ptr<MemPool> m_chunkManagementPool;
 };
 } // namespace mepoo
@@ -14,7 +14,9 @@
 #ifndef IOX_POSH_MEPOO_MEM_POOL_HPP
 #define IOX_POSH_MEPOO_MEM_POOL_HPP
 
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_utils/cxx/helplets.hpp"
+#include "iceoryx_utils/cxx/optional.hpp"
 #include "iceoryx_utils/internal/concurrent/loffli.hpp"
 #include "iceoryx_utils/internal/posix_wrapper/shared_memory_object/allocator.hpp"
 #include "iceoryx_utils/internal/relocatable_pointer/relative_ptr.hpp"
@@ -29,45 +31,139 @@ namespace mepoo
 {
 struct MemPoolInfo
 {
-    MemPoolInfo(uint32_t f_usedChunks, uint32_t f_minFreeChunks, uint32_t f_numChunks, uint32_t f_chunkSize)
+    MemPoolInfo(uint32_t f_usedChunks,
+                uint32_t f_minFreeChunks,
+                uint32_t f_numChunks,
+                uint32_t f_chunkSize,
+                uint32_t f_stashedChunks = 0u)
         : m_usedChunks(f_usedChunks)
         , m_minFreeChunks(f_minFreeChunks)
         , m_numChunks(f_numChunks)
         , m_chunkSize(f_chunkSize)
+        , m_stashedChunks(f_stashedChunks)
     {
     }
     uint32_t m_usedChunks{0};
     uint32_t m_minFreeChunks{0};
     uint32_t m_numChunks{0};
     uint32_t m_chunkSize{0};
+    /// chunks which are neither used nor in the free list since they are stashed in a ChunkMagazine
+    uint32_t m_stashedChunks{0};
+    /// largest payload size which was served by the mempool, only set if the allocation profile is recorded
+    uint32_t m_maxRequestedPayloadSize{0};
 };
 
+class ChunkMagazine;
+
 class MemPool
 {
   public:
     using freeList_t = concurrent::LoFFLi;
     static constexpr uint64_t MEMORY_ALIGNMENT = posix::Allocator::MEMORY_ALIGNMENT;
+    /// a single ChunkMagazine stashes at most this fraction of the chunks of a MemPool
+    static constexpr uint32_t CHUNK_MAGAZINE_SHARE_DIVISOR = 8U;
 
+    /// @param[in] f_numberOfChunkMagazines number of ChunkMagazines which are able to stash chunks of this MemPool
+    /// concurrently, the slots for them are acquired from the management allocator only if this is not 0
     MemPool(const cxx::greater_or_equal<uint32_t, MEMORY_ALIGNMENT> f_chunkSize,
             const cxx::greater_or_equal<uint32_t, 1> f_numberOfChunks,
             posix::Allocator* f_managementAllocator,
-            posix::Allocator* f_payloadAllocator);
+            posix::Allocator* f_payloadAllocator,
+            const uint32_t f_numberOfChunkMagazines = 0u);
 
     MemPool(const MemPool&) = delete;
     MemPool(MemPool&&) = delete;
     MemPool& operator=(const MemPool&) = delete;
     MemPool& operator=(MemPool&&) = delete;
 
+    /// @brief returns the management memory which is required for the slots of the given number of ChunkMagazines
+    static uint64_t requiredChunkMagazineMemorySize(const uint32_t f_numberOfChunkMagazines);
+
+    /// @brief returns a chunk from the free list; if the free list is empty a chunk stashed in a ChunkMagazine is
+    /// reclaimed
+    /// @return pointer to the chunk or nullptr if there is no chunk left
     void* getChunk();
+    /// @brief returns multiple chunks with a single compare-and-swap on the free list for every
+    /// CHUNK_MAGAZINE_CAPACITY chunks; if the free list runs empty chunks stashed in a ChunkMagazine are reclaimed
+    /// @param[out] f_chunks memory for at least f_maxNumberOfChunks pointers
+    /// @param[in] f_maxNumberOfChunks the maximum number of chunks to acquire
+    /// @return the number of acquired chunks, less than f_maxNumberOfChunks if there are no chunks left
+    uint32_t getChunks(void** const f_chunks, const uint32_t f_maxNumberOfChunks);
     uint32_t getChunkSize() const;
     uint32_t getChunkCount() const;
+    /// @brief returns the number of chunks which are handed out to users, chunks stashed in a ChunkMagazine are not
+    /// accounted as used
     uint32_t getUsedChunks() const;
+    /// @brief returns the minimal number of chunks which were not handed out to users, chunks stashed in a
+    /// ChunkMagazine are accounted as free since the MemPool reclaims them when the free list runs empty
     uint32_t getMinFree() const;
+    /// @brief returns the number of chunks which are currently stashed in a ChunkMagazine
+    uint32_t getStashedChunks() const;
+    /// @brief returns the number of ChunkMagazines which are able to stash chunks of this MemPool concurrently
+    uint32_t getChunkMagazineCount() const;
     MemPoolInfo getInfo() const;
 
     void freeChunk(const void* chunk);
 
+  protected:
+    /// the slot operations are protected to allow tests to interleave them deterministically
+    friend class ChunkMagazine;
+
+    /// @brief the stash of a single ChunkMagazine. It lives in the management memory of the MemPool so that the
+    /// stashed chunks can be reclaimed when the free list runs empty and RouDi is able to return them when the owner
+    /// terminates unexpectedly. The owner takes and refills the stash, other users only reclaim chunks from it.
+    struct alignas(64) MagazineSlot
+    {
+        /// lower 32 bit: number of stashed chunks in m_indices; upper 32 bit: generation which is increased on every
+        /// refill and flush to detect that m_indices was changed between reading an index and taking it
+        std::atomic<uint64_t> m_state{0u};
+        /// identifies the ChunkMagazine which owns the slot, 0 if the slot is free
+        std::atomic<uint64_t> m_owner{0u};
+        /// number of entries in m_indices which are neither in the free list nor published in m_state, this is only
+        /// not 0 while a refill or flush is in progress and allows to recover them if the owner terminates
+        std::atomic<uint32_t> m_pending{0u};
+        std::atomic<uint32_t> m_indices[CHUNK_MAGAZINE_CAPACITY];
+    };
+
+    /// @brief reserves a slot for the ChunkMagazine with the given owner id
+    /// @return the index of the slot or an empty optional if all slots are in use
+    cxx::optional<uint32_t> acquireMagazineSlot(const uint64_t owner);
+
+    /// @brief flushes and releases all slots which are owned by the given owner id, this also recovers the chunks
+    /// of a refill or flush which was interrupted by the termination of the owner
+    void releaseMagazineSlots(const uint64_t owner);
+
+    /// @brief refills the empty stash of the slot with up to batchSize chunks by a single operation on the head of
+    /// the free list, the batch is limited by CHUNK_MAGAZINE_SHARE_DIVISOR
+    /// @return the number of stashed chunks
+    uint32_t refillMagazineSlot(const uint32_t slot, const uint32_t batchSize);
+
+    /// @brief takes a chunk from the stash of the slot
+    /// @return pointer to the chunk or nullptr if the stash is empty
+    void* takeFromMagazineSlot(const uint32_t slot);
+
+    /// @brief returns all chunks of the stash of the slot to the free list by a single operation on its head
+    void flushMagazineSlot(const uint32_t slot);
+
+    /// @brief detaches the chunks of the stash of the slot, they are recorded in m_pending until they are back in
+    /// the free list
+    /// @param[in] observedState state of the slot which was read before
+    /// @return the number of detached chunks, 0 if the stash was emptied concurrently
+    uint32_t detachMagazineSlotChunks(const uint32_t slot, uint64_t observedState);
+
+    /// @brief returns the number of chunks in the stash of the slot
+    uint32_t getMagazineSlotSize(const uint32_t slot) const;
+
+    /// @brief returns the state of the slot, see MagazineSlot::m_state
+    uint64_t loadMagazineSlotState(const uint32_t slot) const;
+
+    /// @brief takes a chunk from the stash of any ChunkMagazine
+    /// @return pointer to the chunk or nullptr if all stashes are empty
+    void* reclaimStashedChunk();
+
   private:
+    void pushToFreeList(const uint32_t* const indices, const uint32_t numberOfIndices);
+    void* indexToChunk(const uint32_t index) const;
     void adjustMinFree();
     bool isMultipleOfAlignment(const uint32_t value) const;
 
@@ -84,6 +180,10 @@ class MemPool
     /// @todo: end
 
     freeList_t m_freeIndices;
+
+    uint32_t m_numberOfMagazineSlots{0u};
+    std::atomic<uint32_t> m_stashedChunks{0u};
+    relative_ptr<MagazineSlot> m_magazineSlots;
 };
 
 } // namespace mepoo
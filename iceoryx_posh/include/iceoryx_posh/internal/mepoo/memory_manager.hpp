@@ -15,11 +15,14 @@
 #define IOX_POSH_MEPOO_MEMORY_MANAGER_HPP
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/chunk_magazine.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iceoryx_utils/cxx/helplets.hpp"
 #include "iceoryx_utils/cxx/vector.hpp"
 
+#include <atomic>
 #include <cstdint>
 #include <limits>
 
@@ -31,8 +34,6 @@ namespace iox
 {
 namespace mepoo
 {
-struct MePooConfig;
-
 class MemoryManager
 {
     using MaxSize_t = cxx::range<uint32_t, 1, std::numeric_limits<uint32_t>::max() - sizeof(ChunkHeader)>;
@@ -49,34 +50,107 @@ class MemoryManager
                                 posix::Allocator* f_managementAllocator,
                                 posix::Allocator* f_payloadAllocator);
 
-    SharedChunk getChunk(const MaxSize_t f_size);
+    /// @brief acquires a chunk from the first mempool which fits the requested payload size; if this mempool is
+    /// exhausted, a larger mempool is used according to the MemPoolFallbackPolicy of the MePooConfig
+    /// @param[in] f_size payload size of the chunk
+    /// @param[in] f_magazines optional magazines which stash chunks of the mempools to reduce the contention on the
+    /// free lists, the magazines are used only if they are enabled
+    /// @return the chunk or a SharedChunk which evaluates to false if no chunk could be acquired
+    SharedChunk getChunk(const MaxSize_t f_size, ChunkMagazines* const f_magazines = nullptr);
+
+    /// @brief acquires multiple chunks like getChunk, but takes them with batched pops from the free lists of the
+    /// mempools and the chunk management pool instead of one pop per chunk
+    /// @param[in] f_size payload size of the chunks
+    /// @param[out] f_chunks memory for at least f_numberOfChunks SharedChunks
+    /// @param[in] f_numberOfChunks the number of chunks to acquire
+    /// @param[in] f_magazines optional magazines, see getChunk
+    /// @return the number of acquired chunks, less than f_numberOfChunks if the mempools are exhausted
+    uint32_t getChunks(const MaxSize_t f_size,
+                       SharedChunk* const f_chunks,
+                       const uint32_t f_numberOfChunks,
+                       ChunkMagazines* const f_magazines = nullptr);
 
     uint32_t getMempoolChunkSizeForPayloadSize(const uint32_t f_size) const;
 
     uint32_t getNumberOfMemPools() const;
 
+    MemPoolFallbackPolicy getFallbackPolicy() const;
+
+    ChunkManagementLayout getChunkManagementLayout() const;
+
     MemPoolInfo getMemPoolInfo(uint32_t f_index) const;
 
+    /// @brief returns true if the allocation profile is recorded, see MePooConfig::m_recordAllocationProfile
+    bool isAllocationProfileRecorded() const;
+
+    /// @brief returns the number of requests of the payload size histogram bucket, see
+    /// ALLOCATION_PROFILE_NUMBER_OF_BUCKETS; 0 if the allocation profile is not recorded
+    uint64_t getRequestedPayloadSizeCount(const uint32_t f_bucket) const;
+
     static uint32_t sizeWithChunkHeaderStruct(const MaxSize_t f_size);
 
+    /// @brief returns the number of bytes which are reserved for the ChunkManagement in front of the ChunkHeader
+    static uint32_t chunkManagementSizeInChunk(const ChunkManagementLayout f_layout);
+
     static uint64_t requiredChunkMemorySize(const MePooConfig& f_mePooConfig);
     static uint64_t requiredManagementMemorySize(const MePooConfig& f_mePooConfig);
     static uint64_t requiredFullMemorySize(const MePooConfig& f_mePooConfig);
 
   private:
+    /// @brief returns the chunk size which is required for the payload size including the ChunkHeader and the
+    /// ChunkManagement in the chunk; the sum is computed with 64 bit since it might exceed the range of uint32_t
+    uint64_t chunkSizeForPayloadSize(const uint64_t f_payloadSize) const;
+
     void printMemPoolVector() const;
     void addMemPool(posix::Allocator* f_managementAllocator,
                     posix::Allocator* f_payloadAllocator,
                     const cxx::greater_or_equal<uint32_t, MemPool::MEMORY_ALIGNMENT> f_payloadSize,
-                    const cxx::greater_or_equal<uint32_t, 1> f_numberOfChunks);
+                    const cxx::greater_or_equal<uint32_t, 1> f_numberOfChunks,
+                    const uint32_t f_numberOfChunkMagazines);
     void generateChunkManagementPool(posix::Allocator* f_managementAllocator);
+    void generateSizeClassIndex();
+
+    /// @brief returns the index of the smallest mempool whose chunks are at least f_chunkSize large or
+    /// m_memPoolVector.size() if there is none
+    uint32_t getMemPoolIndexForChunkSize(const uint64_t f_chunkSize) const;
+
+    void* getChunkFromMemPool(const uint32_t f_index, ChunkMagazines* const f_magazines);
+
+    /// @brief returns the index of the largest mempool which may be used according to the MemPoolFallbackPolicy if the
+    /// mempool with f_fittingIndex is exhausted
+    uint32_t getLastMemPoolIndexForFallback(const uint32_t f_fittingIndex) const;
+
+    /// @brief constructs the ChunkHeader and the ChunkManagement of an acquired chunk
+    /// @param[in] f_chunkManagementMemory memory from the chunk management pool, ignored for the IN_CHUNK layout
+    SharedChunk constructChunk(void* const f_chunk,
+                               MemPool* const f_memPool,
+                               void* const f_chunkManagementMemory,
+                               const uint32_t f_payloadSize);
+
+    void recordRequestedPayloadSize(const uint32_t f_payloadSize, const uint32_t f_numberOfChunks);
+    void recordServedPayloadSize(const MemPool* const f_memPool, const uint32_t f_payloadSize);
 
   private:
+    /// one size class for every power of two a uint32_t chunk size is able to reach, including 2^0
+    static constexpr uint32_t NUMBER_OF_SIZE_CLASSES = 33U;
+
     bool m_denyAddMemPool{false};
     uint32_t m_totalNumberOfChunks{0};
+    uint32_t m_maxNumberOfChunkMagazines{0};
+    MemPoolFallbackPolicy m_fallbackPolicy{MemPoolFallbackPolicy::STRICT};
+    ChunkManagementLayout m_chunkManagementLayout{ChunkManagementLayout::SEPARATE_POOL};
+    bool m_recordAllocationProfile{false};
+
+    /// the size class of a chunk size s is the number of bits of s - 1, i.e. 2^(class - 1) < s <= 2^class; the entry
+    /// of a size class is the index of the first mempool whose chunk size is larger than 2^(class - 1), this way a
+    /// lookup compares only the mempools within one size class instead of all mempools
+    uint8_t m_sizeClassIndex[NUMBER_OF_SIZE_CLASSES]{0u};
 
     cxx::vector<MemPool, MAX_NUMBER_OF_MEMPOOLS> m_memPoolVector;
     cxx::vector<MemPool, 1> m_chunkManagementPool;
+
+    std::atomic<uint64_t> m_requestedPayloadSizes[ALLOCATION_PROFILE_NUMBER_OF_BUCKETS]{};
+    std::atomic<uint32_t> m_maxRequestedPayloadSize[MAX_NUMBER_OF_MEMPOOLS]{};
 };
 
 } // namespace mepoo
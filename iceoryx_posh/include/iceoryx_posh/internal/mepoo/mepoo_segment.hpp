@@ -17,6 +17,7 @@
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iceoryx_utils/cxx/string.hpp"
 #include "iceoryx_utils/internal/posix_wrapper/access_control.hpp"
 #include "iceoryx_utils/internal/posix_wrapper/shared_memory_object.hpp"
 #include "iceoryx_utils/internal/posix_wrapper/shared_memory_object/allocator.hpp"
@@ -30,22 +31,39 @@ template <typename SharedMemoryObjectType = posix::SharedMemoryObject, typename
 class MePooSegment
 {
   public:
+    using SharedMemoryName_t = cxx::string<128>;
+
     MePooSegment(const MePooConfig& f_mempoolConfig,
                  posix::Allocator* f_managementAllocator,
                  const posix::PosixGroup& f_readerGroup,
                  const posix::PosixGroup& f_writerGroup,
-                 const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo());
+                 const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo(),
+                 const posix::PageType pageType = posix::PageType::normal,
+                 const posix::PageFaultPolicy pageFaultPolicy = posix::PageFaultPolicy::onDemand);
 
     posix::PosixGroup getWriterGroup() const;
     posix::PosixGroup getReaderGroup() const;
     const SharedMemoryObjectType& getSharedMemoryObject() const;
     MemoryManagerType& getMemoryManager();
+    posix::PageType getPageType() const;
+    posix::PageFaultPolicy getPageFaultPolicy() const;
+    const iox::mepoo::MemoryInfo& getMemoryInfo() const;
+
+    /// @brief the name of the shared memory is derived from the writer group; segments which are bound to a NUMA
+    /// node get the node as suffix, this way a writer group can have one segment per node
+    SharedMemoryName_t getSharedMemoryName() const;
 
     uint64_t getSegmentId() const;
 
   protected:
     SharedMemoryObjectType createSharedMemoryObject(const MePooConfig& f_mempoolConfig,
-                                                    const posix::PosixGroup& f_writerGroup);
+                                                    const posix::PosixGroup& f_writerGroup,
+                                                    const iox::mepoo::MemoryInfo& f_memoryInfo,
+                                                    const posix::PageType f_pageType,
+                                                    const posix::PageFaultPolicy f_pageFaultPolicy);
+
+    static SharedMemoryName_t sharedMemoryName(const posix::PosixGroup& f_writerGroup,
+                                        const iox::mepoo::MemoryInfo& f_memoryInfo);
 
   protected:
     SharedMemoryObjectType m_sharedMemoryObject;
@@ -54,6 +72,8 @@ class MePooSegment
     posix::PosixGroup m_writerGroup;
     uint64_t m_segmentId;
     iox::mepoo::MemoryInfo m_memoryInfo;
+    posix::PageType m_pageType{posix::PageType::normal};
+    posix::PageFaultPolicy m_pageFaultPolicy{posix::PageFaultPolicy::onDemand};
 
   private:
     void setSegmentId(const uint64_t segmentId);
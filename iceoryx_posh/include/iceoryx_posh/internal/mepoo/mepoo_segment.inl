@@ -24,16 +24,25 @@ namespace iox
 {
 namespace mepoo
 {
+static_assert(MemoryInfo::ANY_NUMA_NODE == posix::MemoryMap::ANY_NUMA_NODE,
+              "the NUMA node of a segment is passed unchanged to the SharedMemoryObject");
+
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
-inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(const MePooConfig& f_mempoolConfig,
-                                                                             posix::Allocator* f_managementAllocator,
-                                                                             const posix::PosixGroup& f_readerGroup,
-                                                                             const posix::PosixGroup& f_writerGroup,
-                                                                             const iox::mepoo::MemoryInfo& memoryInfo)
-    : m_sharedMemoryObject(createSharedMemoryObject(f_mempoolConfig, f_writerGroup))
+inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(
+    const MePooConfig& f_mempoolConfig,
+    posix::Allocator* f_managementAllocator,
+    const posix::PosixGroup& f_readerGroup,
+    const posix::PosixGroup& f_writerGroup,
+    const iox::mepoo::MemoryInfo& memoryInfo,
+    const posix::PageType pageType,
+    const posix::PageFaultPolicy pageFaultPolicy)
+    : m_sharedMemoryObject(
+        createSharedMemoryObject(f_mempoolConfig, f_writerGroup, memoryInfo, pageType, pageFaultPolicy))
     , m_readerGroup(f_readerGroup)
     , m_writerGroup(f_writerGroup)
     , m_memoryInfo(memoryInfo)
+    , m_pageType(pageType)
+    , m_pageFaultPolicy(pageFaultPolicy)
 {
     using namespace posix;
     AccessController f_accessController;
@@ -59,19 +68,25 @@ inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(con
 
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
 inline SharedMemoryObjectType MePooSegment<SharedMemoryObjectType, MemoryManagerType>::createSharedMemoryObject(
-    const MePooConfig& f_mempoolConfig, const posix::PosixGroup& f_writerGroup)
+    const MePooConfig& f_mempoolConfig,
+    const posix::PosixGroup& f_writerGroup,
+    const iox::mepoo::MemoryInfo& f_memoryInfo,
+    const posix::PageType f_pageType,
+    const posix::PageFaultPolicy f_pageFaultPolicy)
 {
     // we let the OS decide where to map the shm segments
     constexpr void* BASE_ADDRESS_HINT{nullptr};
 
-    // on qnx the current working directory will be added to the /dev/shmem path if the leading slash is missing
-    auto shmName = "/" + f_writerGroup.getName();
+    auto shmName = sharedMemoryName(f_writerGroup, f_memoryInfo);
     auto retVal = SharedMemoryObjectType::create(shmName.c_str(),
                                                  MemoryManager::requiredChunkMemorySize(f_mempoolConfig),
                                                  posix::AccessMode::readWrite,
                                                  posix::OwnerShip::mine,
                                                  BASE_ADDRESS_HINT,
-                                                 S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP);
+                                                 S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP,
+                                                 f_pageType,
+                                                 f_pageFaultPolicy,
+                                                 f_memoryInfo.numaNode);
     if (!retVal.has_value())
     {
         errorHandler(Error::kMEPOO__SEGMENT_UNABLE_TO_CREATE_SHARED_MEMORY_OBJECT);
@@ -86,6 +101,29 @@ inline SharedMemoryObjectType MePooSegment<SharedMemoryObjectType, MemoryManager
     return std::move(retVal.value());
 }
 
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline typename MePooSegment<SharedMemoryObjectType, MemoryManagerType>::SharedMemoryName_t
+MePooSegment<SharedMemoryObjectType, MemoryManagerType>::sharedMemoryName(const posix::PosixGroup& f_writerGroup,
+                                                                          const iox::mepoo::MemoryInfo& f_memoryInfo)
+{
+    // on qnx the current working directory will be added to the /dev/shmem path if the leading slash is missing
+    SharedMemoryName_t shmName = "/" + f_writerGroup.getName();
+    if (f_memoryInfo.numaNode != MemoryInfo::ANY_NUMA_NODE)
+    {
+        shmName.append(cxx::TruncateToCapacity, "_numa");
+        shmName.append(cxx::TruncateToCapacity,
+                       cxx::string<10>(cxx::TruncateToCapacity, std::to_string(f_memoryInfo.numaNode).c_str()));
+    }
+    return shmName;
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline typename MePooSegment<SharedMemoryObjectType, MemoryManagerType>::SharedMemoryName_t
+MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getSharedMemoryName() const
+{
+    return sharedMemoryName(m_writerGroup, m_memoryInfo);
+}
+
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
 inline posix::PosixGroup MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getWriterGroup() const
 {
@@ -104,6 +142,24 @@ inline MemoryManagerType& MePooSegment<SharedMemoryObjectType, MemoryManagerType
     return m_memoryManager;
 }
 
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline posix::PageType MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getPageType() const
+{
+    return m_pageType;
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline posix::PageFaultPolicy MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getPageFaultPolicy() const
+{
+    return m_pageFaultPolicy;
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline const iox::mepoo::MemoryInfo& MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getMemoryInfo() const
+{
+    return m_memoryInfo;
+}
+
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
 inline const SharedMemoryObjectType&
 MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getSharedMemoryObject() const
@@ -57,13 +57,17 @@ class SegmentManager
                        uint64_t size,
                        bool isWritable,
                        uint64_t segmentId,
-                       const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo())
+                       const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo(),
+                       const posix::PageType pageType = posix::PageType::normal,
+                       const posix::PageFaultPolicy pageFaultPolicy = posix::PageFaultPolicy::onDemand)
             : m_sharedMemoryName(sharedMemoryName)
             , m_startAddress(startAddress)
             , m_size(size)
             , m_isWritable(isWritable)
             , m_segmentId(segmentId)
             , m_memoryInfo(memoryInfo)
+            , m_pageType(pageType)
+            , m_pageFaultPolicy(pageFaultPolicy)
 
         {
         }
@@ -74,6 +78,8 @@ class SegmentManager
         bool m_isWritable{false};
         uint64_t m_segmentId{0};
         iox::mepoo::MemoryInfo m_memoryInfo; // we can specify additional info about a segments memory here
+        posix::PageType m_pageType{posix::PageType::normal};
+        posix::PageFaultPolicy m_pageFaultPolicy{posix::PageFaultPolicy::onDemand};
     };
 
     struct SegmentUserInformation
@@ -85,7 +91,14 @@ class SegmentManager
     using SegmentMappingContainer = cxx::vector<SegmentMapping, MAX_SHM_SEGMENTS>;
 
     SegmentMappingContainer getSegmentMappings(posix::PosixUser f_user);
-    SegmentUserInformation getSegmentInformationForUser(posix::PosixUser f_user);
+
+    /// @brief provides the memory manager of the writable segment of a user
+    /// @param[in] f_user the user for which the segment is searched
+    /// @param[in] f_numaNode if the writer group of the user has segments on several NUMA nodes, the segment on this
+    /// node is preferred; if there is none, the first segment of the writer group is used
+    /// @return the memory manager and the segment id, or a nullptr memory manager if the user has no writable segment
+    SegmentUserInformation getSegmentInformationForUser(posix::PosixUser f_user,
+                                                        const uint32_t f_numaNode = MemoryInfo::ANY_NUMA_NODE);
 
     static uint64_t requiredManagementMemorySize(const SegmentConfig& f_config);
     static uint64_t requiredChunkMemorySize(const SegmentConfig& f_config);
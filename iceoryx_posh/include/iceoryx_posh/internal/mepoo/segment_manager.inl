@@ -37,6 +37,14 @@ inline SegmentManager<SegmentType>::SegmentManager(const SegmentConfig& f_segmen
 template <typename SegmentType>
 inline bool SegmentManager<SegmentType>::createSegment(const SegmentConfig::SegmentEntry& f_segmentEntry)
 {
+    // the reference counter is in the payload segment and readers must be able to update it
+    if (f_segmentEntry.m_mempoolConfig.m_chunkManagementLayout == ChunkManagementLayout::IN_CHUNK
+        && f_segmentEntry.m_readerGroup != f_segmentEntry.m_writerGroup)
+    {
+        errorHandler(Error::kMEPOO__SEGMENT_IN_CHUNK_LAYOUT_REQUIRES_EQUAL_READER_AND_WRITER_GROUP);
+        return false;
+    }
+
     if (m_segmentContainer.size() < m_segmentContainer.capacity())
     {
         auto readerGroup = iox::posix::PosixGroup(f_segmentEntry.m_readerGroup);
@@ -45,7 +53,9 @@ inline bool SegmentManager<SegmentType>::createSegment(const SegmentConfig::Segm
                                         m_managementAllocator,
                                         readerGroup,
                                         writerGroup,
-                                        f_segmentEntry.m_memoryInfo);
+                                        f_segmentEntry.m_memoryInfo,
+                                        f_segmentEntry.m_pageType,
+                                        f_segmentEntry.m_pageFaultPolicy);
         return true;
     }
     else
@@ -63,7 +73,7 @@ SegmentManager<SegmentType>::getSegmentMappings(posix::PosixUser f_user)
     auto l_groupContainer = f_user.getGroups();
 
     SegmentManager::SegmentMappingContainer l_mappingContainer;
-    bool l_foundInWriterGroup = false;
+    const posix::PosixGroup* l_writerGroup{nullptr};
 
     // with the groups we can get all the segments (read or write) for the user
     for (const auto& groupID : l_groupContainer)
@@ -73,15 +83,18 @@ SegmentManager<SegmentType>::getSegmentMappings(posix::PosixUser f_user)
             if (segment.getWriterGroup() == groupID)
             {
                 // a user is allowed to be only in one writer group, as we currently only support one memory manager per
-                // process
-                if (!l_foundInWriterGroup)
+                // process; the writer group can have several segments on different NUMA nodes
+                if (l_writerGroup == nullptr || *l_writerGroup == groupID)
                 {
-                    l_mappingContainer.emplace_back("/" + segment.getWriterGroup().getName(),
+                    l_mappingContainer.emplace_back(segment.getSharedMemoryName(),
                                                     segment.getSharedMemoryObject().getBaseAddress(),
                                                     segment.getSharedMemoryObject().getSizeInBytes(),
                                                     true,
-                                                    segment.getSegmentId());
-                    l_foundInWriterGroup = true;
+                                                    segment.getSegmentId(),
+                                                    segment.getMemoryInfo(),
+                                                    segment.getPageType(),
+                                                    segment.getPageFaultPolicy());
+                    l_writerGroup = &groupID;
                 }
                 else
                 {
@@ -104,11 +117,14 @@ SegmentManager<SegmentType>::getSegmentMappings(posix::PosixUser f_user)
                                 })
                        == l_mappingContainer.end())
             {
-                l_mappingContainer.emplace_back("/" + segment.getWriterGroup().getName(),
+                l_mappingContainer.emplace_back(segment.getSharedMemoryName(),
                                                 segment.getSharedMemoryObject().getBaseAddress(),
                                                 segment.getSharedMemoryObject().getSizeInBytes(),
                                                 false,
-                                                segment.getSegmentId());
+                                                segment.getSegmentId(),
+                                                segment.getMemoryInfo(),
+                                                segment.getPageType(),
+                                                segment.getPageFaultPolicy());
             }
         }
     }
@@ -118,7 +134,7 @@ SegmentManager<SegmentType>::getSegmentMappings(posix::PosixUser f_user)
 
 template <typename SegmentType>
 inline typename SegmentManager<SegmentType>::SegmentUserInformation
-SegmentManager<SegmentType>::getSegmentInformationForUser(posix::PosixUser f_user)
+SegmentManager<SegmentType>::getSegmentInformationForUser(posix::PosixUser f_user, const uint32_t f_numaNode)
 {
     auto l_groupContainer = f_user.getGroups();
 
@@ -131,11 +147,23 @@ SegmentManager<SegmentType>::getSegmentInformationForUser(posix::PosixUser f_use
         {
             if (segment.getWriterGroup() == groupID)
             {
-                segmentInfo.m_memoryManager = &segment.getMemoryManager();
-                segmentInfo.m_segmentID = segment.getSegmentId();
-                return segmentInfo;
+                if (segmentInfo.m_memoryManager == nullptr || segment.getMemoryInfo().numaNode == f_numaNode)
+                {
+                    segmentInfo.m_memoryManager = &segment.getMemoryManager();
+                    segmentInfo.m_segmentID = segment.getSegmentId();
+                }
+                if (f_numaNode == MemoryInfo::ANY_NUMA_NODE || segment.getMemoryInfo().numaNode == f_numaNode)
+                {
+                    return segmentInfo;
+                }
             }
         }
+
+        // only one writer group per user is supported
+        if (segmentInfo.m_memoryManager != nullptr)
+        {
+            return segmentInfo;
+        }
     }
 
     return segmentInfo;
@@ -94,6 +94,12 @@ class ChunkDistributor
     /// @param[in] shared chunk to be delivered
     void deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief Deliver the provided shared chunks in their order to all the stored chunk queues while the lock is held
+    /// only once. The chunks will be added to the chunk history
+    /// @param[in] chunks shared chunks to be delivered
+    /// @param[in] numberOfChunks number of chunks in chunks
+    void deliverToAllStoredQueues(const mepoo::SharedChunk* const chunks, const uint32_t numberOfChunks) noexcept;
+
     /// @brief Deliver the provided shared chunk to the provided chunk queue. The chunk will NOT be added to the chunk
     /// history
     /// @param[in] chunk queue to which this chunk shall be delivered
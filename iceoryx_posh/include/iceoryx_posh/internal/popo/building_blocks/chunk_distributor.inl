@@ -136,6 +136,26 @@ inline void ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues
     addToHistoryWithoutDelivery(chunk);
 }
 
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues(const mepoo::SharedChunk* const chunks,
+                                                                                 const uint32_t numberOfChunks) noexcept
+{
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+
+    for (auto& queue : getMembers()->m_queues)
+    {
+        for (uint32_t i = 0u; i < numberOfChunks; ++i)
+        {
+            deliverToQueue(queue.get(), chunks[i]);
+        }
+    }
+
+    for (uint32_t i = 0u; i < numberOfChunks; ++i)
+    {
+        addToHistoryWithoutDelivery(chunks[i]);
+    }
+}
+
 template <typename ChunkDistributorDataType>
 inline void ChunkDistributor<ChunkDistributorDataType>::deliverToQueue(cxx::not_null<ChunkQueueData_t* const> queue,
                                                                        mepoo::SharedChunk chunk) noexcept
@@ -83,6 +83,16 @@ inline void ChunkReceiver<ChunkReceiverDataType>::release(const mepoo::ChunkHead
     }
 }
 
+template <typename ChunkReceiverDataType>
+inline void ChunkReceiver<ChunkReceiverDataType>::releaseN(const mepoo::ChunkHeader* const* const chunkHeaders,
+                                                           const uint32_t numberOfChunks) noexcept
+{
+    if (getMembers()->m_chunksInUse.remove(chunkHeaders, numberOfChunks) != numberOfChunks)
+    {
+        errorHandler(Error::kPOPO__CHUNK_RECEIVER_INVALID_CHUNK_TO_RELEASE_FROM_USER, nullptr, ErrorLevel::SEVERE);
+    }
+}
+
 template <typename ChunkReceiverDataType>
 inline void ChunkReceiver<ChunkReceiverDataType>::releaseAll() noexcept
 {
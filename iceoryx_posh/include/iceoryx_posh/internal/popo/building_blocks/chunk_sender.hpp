@@ -65,6 +65,18 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
     cxx::expected<mepoo::ChunkHeader*, AllocationError> tryAllocate(const uint32_t payloadSize,
                                                                     const UniquePortId originId) noexcept;
 
+    /// @brief allocate multiple chunks with batched pops from the mempools, either all chunks are allocated or none
+    /// @param[in] payloadSize, size of the user paylaod of each chunk without additional headers
+    /// @param[in] originId, the unique id of the entity which requested this allocate
+    /// @param[out] chunkHeaders, memory for at least numberOfChunks pointers which are set to the ChunkHeaders of the
+    /// allocated chunks
+    /// @param[in] numberOfChunks, number of chunks to allocate
+    /// @return success if all chunks were allocated, error if not
+    cxx::expected<AllocationError> tryAllocateN(const uint32_t payloadSize,
+                                                const UniquePortId originId,
+                                                mepoo::ChunkHeader** const chunkHeaders,
+                                                const uint32_t numberOfChunks) noexcept;
+
     /// @brief Release an allocated chunk without sending it
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void release(const mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -73,6 +85,12 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
     /// @param[in] chunkHeader, pointer to the ChunkHeader to send
     void send(mepoo::ChunkHeader* const chunkHeader) noexcept;
 
+    /// @brief Send multiple allocated chunks in their order to all connected ChunkQueuePopper, the queues are locked
+    /// only once for all chunks
+    /// @param[in] chunkHeaders, pointers to the ChunkHeaders to send
+    /// @param[in] numberOfChunks, number of pointers in chunkHeaders
+    void sendN(mepoo::ChunkHeader* const* const chunkHeaders, const uint32_t numberOfChunks) noexcept;
+
     /// @brief Push an allocated chunk to the history without sending it
     /// @param[in] chunkHeader, pointer to the ChunkHeader to push to the history
     void pushToHistory(mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -81,6 +99,13 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
     /// @return pointer to the ChunkHeader of the last sent Chunk if there is one, empty optional if not
     cxx::optional<const mepoo::ChunkHeader*> tryGetPreviousChunk() const noexcept;
 
+    /// @brief Enables or disables the chunk magazines which stash chunks of the mempools for this ChunkSender. With
+    /// enabled magazines the chunks are taken in batches from the mempools which reduces the contention on the free
+    /// lists when many ChunkSenders allocate from the same mempool in parallel. Stashed chunks are not available for
+    /// other ChunkSenders.
+    /// @param[in] batchSize number of chunks which are taken at once from a mempool, 0 disables the magazines
+    void setChunkMagazineBatchSize(const uint32_t batchSize) noexcept;
+
     /// @brief Release all the chunks that are currently held. Caution: Only call this if the user process is no more
     /// running E.g. This cleans up chunks that were held by a user process that died unexpectetly, for avoiding lost
     /// chunks in the system
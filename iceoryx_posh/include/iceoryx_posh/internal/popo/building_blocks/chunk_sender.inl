@@ -62,7 +62,7 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const uint32_t payloadSize, const
     {
         // BEGIN of critical section, chunk will be lost if process gets hard terminated in between
         // get a new chunk
-        mepoo::SharedChunk chunk = getMembers()->m_memoryMgr->getChunk(payloadSize);
+        mepoo::SharedChunk chunk = getMembers()->m_memoryMgr->getChunk(payloadSize, &getMembers()->m_chunkMagazines);
 
         if (chunk)
         {
@@ -87,6 +87,51 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const uint32_t payloadSize, const
     }
 }
 
+template <typename ChunkSenderDataType>
+inline cxx::expected<AllocationError>
+ChunkSender<ChunkSenderDataType>::tryAllocateN(const uint32_t payloadSize,
+                                               const UniquePortId originId,
+                                               mepoo::ChunkHeader** const chunkHeaders,
+                                               const uint32_t numberOfChunks) noexcept
+{
+    if (numberOfChunks > MemberType_t::MAX_CHUNKS_ALLOCATED_SIMULTANEOUSLY)
+    {
+        return cxx::error<AllocationError>(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
+    }
+
+    // BEGIN of critical section, chunks will be lost if process gets hard terminated in between
+    mepoo::SharedChunk chunks[MemberType_t::MAX_CHUNKS_ALLOCATED_SIMULTANEOUSLY];
+    if (getMembers()->m_memoryMgr->getChunks(payloadSize, chunks, numberOfChunks, &getMembers()->m_chunkMagazines)
+        < numberOfChunks)
+    {
+        // the acquired chunks are released by the d'tor of the SharedChunks
+        return cxx::error<AllocationError>(AllocationError::RUNNING_OUT_OF_CHUNKS);
+    }
+
+    for (uint32_t i = 0u; i < numberOfChunks; ++i)
+    {
+        // if the application allocated too much chunks, return no chunk at all
+        if (!getMembers()->m_chunksInUse.insert(chunks[i]))
+        {
+            for (uint32_t j = 0u; j < i; ++j)
+            {
+                mepoo::SharedChunk insertedChunk(nullptr);
+                // PRQA S 3803 1 # the chunk was inserted above, the d'tor of both SharedChunks releases it
+                getMembers()->m_chunksInUse.remove(chunks[j].getChunkHeader(), insertedChunk);
+            }
+            return cxx::error<AllocationError>(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
+        }
+    }
+    // END of critical section, chunks will be lost if process gets hard terminated in between
+
+    for (uint32_t i = 0u; i < numberOfChunks; ++i)
+    {
+        chunks[i].getChunkHeader()->m_originId = originId;
+        chunkHeaders[i] = chunks[i].getChunkHeader();
+    }
+    return cxx::success<void>();
+}
+
 template <typename ChunkSenderDataType>
 inline void ChunkSender<ChunkSenderDataType>::release(const mepoo::ChunkHeader* const chunkHeader) noexcept
 {
@@ -111,6 +156,31 @@ inline void ChunkSender<ChunkSenderDataType>::send(mepoo::ChunkHeader* const chu
     // END of critical section, chunk will be lost if process gets hard terminated in between
 }
 
+template <typename ChunkSenderDataType>
+inline void ChunkSender<ChunkSenderDataType>::sendN(mepoo::ChunkHeader* const* const chunkHeaders,
+                                                    const uint32_t numberOfChunks) noexcept
+{
+    // there can't be more valid chunks than chunks in use, further ones are reported by getChunkReadyForSend
+    mepoo::SharedChunk chunks[MemberType_t::MAX_CHUNKS_ALLOCATED_SIMULTANEOUSLY];
+    uint32_t numberOfValidChunks{0u};
+    // BEGIN of critical section, chunks will be lost if process gets hard terminated in between
+    for (uint32_t i = 0u; i < numberOfChunks; ++i)
+    {
+        mepoo::SharedChunk chunk(nullptr);
+        if (getChunkReadyForSend(chunkHeaders[i], chunk))
+        {
+            chunks[numberOfValidChunks++] = std::move(chunk);
+        }
+    }
+
+    if (numberOfValidChunks > 0u)
+    {
+        this->deliverToAllStoredQueues(chunks, numberOfValidChunks);
+        getMembers()->m_lastChunk = chunks[numberOfValidChunks - 1u];
+    }
+    // END of critical section, chunks will be lost if process gets hard terminated in between
+}
+
 template <typename ChunkSenderDataType>
 inline void ChunkSender<ChunkSenderDataType>::pushToHistory(mepoo::ChunkHeader* const chunkHeader) noexcept
 {
@@ -137,12 +207,19 @@ inline cxx::optional<const mepoo::ChunkHeader*> ChunkSender<ChunkSenderDataType>
     }
 }
 
+template <typename ChunkSenderDataType>
+inline void ChunkSender<ChunkSenderDataType>::setChunkMagazineBatchSize(const uint32_t batchSize) noexcept
+{
+    getMembers()->m_chunkMagazines.setBatchSize(batchSize);
+}
+
 template <typename ChunkSenderDataType>
 inline void ChunkSender<ChunkSenderDataType>::releaseAll() noexcept
 {
     getMembers()->m_chunksInUse.cleanup();
     this->cleanup();
     getMembers()->m_lastChunk = nullptr;
+    getMembers()->m_chunkMagazines.flush();
 }
 
 template <typename ChunkSenderDataType>
@@ -59,6 +59,30 @@ inline cxx::expected<Sample<T>, AllocationError> BasePublisher<T, port_t>::loan(
     }
 }
 
+template <typename T, typename port_t>
+inline cxx::expected<typename BasePublisher<T, port_t>::SampleBatch_t, AllocationError>
+BasePublisher<T, port_t>::loanN(const uint32_t numberOfSamples, const uint32_t size) noexcept
+{
+    if (numberOfSamples > MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY)
+    {
+        return cxx::error<AllocationError>(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
+    }
+
+    mepoo::ChunkHeader* headers[MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY];
+    auto result = m_port.tryAllocateChunks(size, headers, numberOfSamples);
+    if (result.has_error())
+    {
+        return cxx::error<AllocationError>(result.get_error());
+    }
+
+    SampleBatch_t samples;
+    for (uint32_t i = 0u; i < numberOfSamples; ++i)
+    {
+        samples.emplace_back(convertChunkHeaderToSample(headers[i]));
+    }
+    return cxx::success<SampleBatch_t>(std::move(samples));
+}
+
 template <typename T, typename port_t>
 inline void BasePublisher<T, port_t>::publish(Sample<T>&& sample) noexcept
 {
@@ -67,6 +91,25 @@ inline void BasePublisher<T, port_t>::publish(Sample<T>&& sample) noexcept
     sample.release(); // Must release ownership of the sample as the sender port takes it when publishing.
 }
 
+template <typename T, typename port_t>
+inline void BasePublisher<T, port_t>::publishN(SampleBatch_t&& samples) noexcept
+{
+    mepoo::ChunkHeader* headers[MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY];
+    uint32_t numberOfHeaders{0u};
+    for (auto& sample : samples)
+    {
+        headers[numberOfHeaders++] = mepoo::convertPayloadPointerToChunkHeader(reinterpret_cast<void*>(sample.get()));
+    }
+    m_port.sendChunks(headers, numberOfHeaders);
+
+    // Must release ownership of the samples as the sender port takes them when publishing.
+    for (auto& sample : samples)
+    {
+        sample.release();
+    }
+    samples.clear();
+}
+
 template <typename T, typename port_t>
 inline cxx::optional<Sample<T>> BasePublisher<T, port_t>::loanPreviousSample() noexcept
 {
@@ -102,6 +145,12 @@ inline bool BasePublisher<T, port_t>::hasSubscribers() const noexcept
     return m_port.hasSubscribers();
 }
 
+template <typename T, typename port_t>
+inline void BasePublisher<T, port_t>::setChunkMagazineBatchSize(const uint32_t batchSize) noexcept
+{
+    m_port.setChunkMagazineBatchSize(batchSize);
+}
+
 template <typename T, typename port_t>
 inline Sample<T> BasePublisher<T, port_t>::convertChunkHeaderToSample(const mepoo::ChunkHeader* const header) noexcept
 {
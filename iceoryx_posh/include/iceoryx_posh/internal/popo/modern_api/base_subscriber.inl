@@ -110,6 +110,25 @@ inline void BaseSubscriber<T, port_t>::releaseQueuedSamples() noexcept
     m_port.releaseQueuedChunks();
 }
 
+template <typename T, typename port_t>
+inline void BaseSubscriber<T, port_t>::releaseN(SampleBatch_t&& samples) noexcept
+{
+    const mepoo::ChunkHeader* headers[MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY];
+    uint32_t numberOfHeaders{0u};
+    for (auto& sample : samples)
+    {
+        headers[numberOfHeaders++] = sample.getHeader();
+    }
+    m_port.releaseChunks(headers, numberOfHeaders);
+
+    // Must release ownership of the samples as the subscriber port released their chunks already.
+    for (auto& sample : samples)
+    {
+        sample.release();
+    }
+    samples.clear();
+}
+
 template <typename T, typename port_t>
 inline void
 BaseSubscriber<T, port_t>::setConditionVariable(ConditionVariableData* const conditionVariableDataPtr) noexcept
@@ -147,6 +147,12 @@ inline const mepoo::ChunkHeader* Sample<const T>::getHeader() noexcept
     return mepoo::convertPayloadPointerToChunkHeader(m_samplePtr.get());
 }
 
+template <typename T>
+inline void Sample<const T>::release() noexcept
+{
+    m_samplePtr.release();
+}
+
 } // namespace popo
 } // namespace iox
 
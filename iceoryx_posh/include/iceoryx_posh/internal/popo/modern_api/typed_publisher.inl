@@ -36,6 +36,19 @@ inline cxx::expected<Sample<T>, AllocationError> TypedPublisher<T, base_publishe
     return std::move(base_publisher_t::loan(sizeof(T)).and_then([](Sample<T>& sample) { new (sample.get()) T(); }));
 }
 
+template <typename T, typename base_publisher_t>
+inline cxx::expected<typename TypedPublisher<T, base_publisher_t>::SampleBatch_t, AllocationError>
+TypedPublisher<T, base_publisher_t>::loanN(const uint32_t numberOfSamples) noexcept
+{
+    // See loan() why the samples are default constructed.
+    return std::move(base_publisher_t::loanN(numberOfSamples, sizeof(T)).and_then([](SampleBatch_t& samples) {
+        for (auto& sample : samples)
+        {
+            new (sample.get()) T();
+        }
+    }));
+}
+
 template <typename T, typename base_publisher_t>
 template <typename Callable, typename... ArgTypes>
 inline cxx::expected<AllocationError> TypedPublisher<T, base_publisher_t>::publishResultOf(Callable c,
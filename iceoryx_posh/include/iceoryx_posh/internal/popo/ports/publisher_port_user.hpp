@@ -52,6 +52,17 @@ class PublisherPortUser : public BasePort
     /// not
     cxx::expected<mepoo::ChunkHeader*, AllocationError> tryAllocateChunk(const uint32_t payloadSize) noexcept;
 
+    /// @brief Allocate multiple chunks at once, either all chunks are allocated or none
+    /// @param[in] payloadSize, size of the user paylaod of each chunk without additional headers
+    /// @param[out] chunkHeaders, memory for at least numberOfChunks pointers which are set to the ChunkHeaders of the
+    /// allocated chunks
+    /// @param[in] numberOfChunks, number of chunks to allocate,
+    /// at most MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY
+    /// @return success if all chunks were allocated, error if not
+    cxx::expected<AllocationError> tryAllocateChunks(const uint32_t payloadSize,
+                                                     mepoo::ChunkHeader** const chunkHeaders,
+                                                     const uint32_t numberOfChunks) noexcept;
+
     /// @brief Free an allocated chunk without sending it
     /// @param[in] chunkHeader, pointer to the ChunkHeader to free
     void freeChunk(mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -60,10 +71,22 @@ class PublisherPortUser : public BasePort
     /// @param[in] chunkHeader, pointer to the ChunkHeader to send
     void sendChunk(mepoo::ChunkHeader* const chunkHeader) noexcept;
 
+    /// @brief Send multiple allocated chunks in their order to all connected subscriber ports with a single delivery
+    /// pass
+    /// @param[in] chunkHeaders, pointers to the ChunkHeaders to send
+    /// @param[in] numberOfChunks, number of pointers in chunkHeaders
+    void sendChunks(mepoo::ChunkHeader* const* const chunkHeaders, const uint32_t numberOfChunks) noexcept;
+
     /// @brief Returns the last sent chunk if there is one
     /// @return pointer to the ChunkHeader of the last sent Chunk if there is one, empty optional if not
     cxx::optional<const mepoo::ChunkHeader*> tryGetPreviousChunk() const noexcept;
 
+    /// @brief Enables or disables the chunk magazines of this publisher port which take the chunks in batches from the
+    /// mempools. This reduces the contention on the mempools if many publishers allocate chunks of the same size in
+    /// parallel but the stashed chunks are not available for other publishers.
+    /// @param[in] batchSize number of chunks which are taken at once from a mempool, 0 disables the magazines
+    void setChunkMagazineBatchSize(const uint32_t batchSize) noexcept;
+
     /// @brief offer this publiher port in the system
     void offer() noexcept;
 
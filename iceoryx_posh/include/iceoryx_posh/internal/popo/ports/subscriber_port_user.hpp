@@ -70,6 +70,11 @@ class SubscriberPortUser : public BasePort
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void releaseChunk(const mepoo::ChunkHeader* const chunkHeader) noexcept;
 
+    /// @brief Release multiple chunks that were obtained with tryGetChunk
+    /// @param[in] chunkHeaders, pointers to the ChunkHeaders to release
+    /// @param[in] numberOfChunks, number of pointers in chunkHeaders
+    void releaseChunks(const mepoo::ChunkHeader* const* const chunkHeaders, const uint32_t numberOfChunks) noexcept;
+
     /// @brief Release all the chunks that are currently queued up.
     void releaseQueuedChunks() noexcept;
 
@@ -102,6 +102,58 @@ class UsedChunkList
         return false;
     }
 
+    // only from runtime context
+    /// @brief removes the chunks with the given headers in a single pass over the used list and releases them
+    /// @return the number of removed chunks, less than f_numberOfChunks if some headers are not in the list
+    uint32_t remove(const mepoo::ChunkHeader* const* const f_chunkHeaders, const uint32_t f_numberOfChunks)
+    {
+        uint32_t numberOfRemovedChunks{0u};
+        uint32_t previous = InvalidIndex;
+        uint32_t current = m_usedListHead;
+        while (current != InvalidIndex && numberOfRemovedChunks < f_numberOfChunks)
+        {
+            const uint32_t next = m_list[current];
+            bool isRequested{false};
+            for (uint32_t i = 0u; i < f_numberOfChunks && !isRequested; ++i)
+            {
+                isRequested = (m_data[current] != nullptr && m_data[current]->m_chunkHeader == f_chunkHeaders[i]);
+            }
+
+            if (isRequested)
+            {
+                // the d'tor of the SharedChunk releases the chunk
+                mepoo::SharedChunk{m_data[current]};
+                m_data[current] = nullptr;
+
+                // remove index from used list
+                if (current == m_usedListHead)
+                {
+                    m_usedListHead = next;
+                }
+                else
+                {
+                    m_list[previous] = next;
+                }
+
+                // insert index to free list
+                m_list[current] = m_freeListHead;
+                m_freeListHead = current;
+                ++numberOfRemovedChunks;
+            }
+            else
+            {
+                previous = current;
+            }
+            current = next;
+        }
+
+        if (numberOfRemovedChunks > 0u)
+        {
+            m_synchronizer.clear(std::memory_order_release);
+        }
+        return numberOfRemovedChunks;
+    }
+
     // only once from runtime context
     void setup()
     {
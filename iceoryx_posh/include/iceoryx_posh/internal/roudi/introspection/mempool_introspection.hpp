@@ -131,6 +131,7 @@ class MemPoolIntrospection
 
     // copy data fro internal struct into interface struct
     void copyMemPoolInfo(const MemoryManager& memoryManager, MemPoolInfoContainer& dest) noexcept;
+    void copyAllocationProfile(const MemoryManager& memoryManager, MemPoolIntrospectionInfo& dest) noexcept;
 };
 
 /**
@@ -147,6 +147,7 @@ void MemPoolIntrospection<MemoryManager, SegmentManager, SenderPort>::send() noe
                                        posix::PosixGroup::getGroupOfCurrentProcess(),
                                        id);
             copyMemPoolInfo(*m_rouDiInternalMemoryManager, memPoolIntrospectionInfo.m_mempoolInfo);
+            copyAllocationProfile(*m_rouDiInternalMemoryManager, memPoolIntrospectionInfo);
             ++id;
 
             // User shm segments
@@ -158,6 +159,7 @@ void MemPoolIntrospection<MemoryManager, SegmentManager, SenderPort>::send() noe
                     prepareIntrospectionSample(
                         memPoolIntrospectionInfo, segment.getReaderGroup(), segment.getWriterGroup(), id);
                     copyMemPoolInfo(segment.getMemoryManager(), memPoolIntrospectionInfo.m_mempoolInfo);
+                    copyAllocationProfile(segment.getMemoryManager(), memPoolIntrospectionInfo);
                 }
                 else
                 {
@@ -185,6 +187,8 @@ void MemPoolIntrospection<MemoryManager, SegmentManager, SenderPort>::copyMemPoo
     const MemoryManager& memoryManager, MemPoolInfoContainer& dest) noexcept
 {
     auto numOfMemPools = memoryManager.getNumberOfMemPools();
+    const uint32_t chunkManagementSize =
+        mepoo::MemoryManager::chunkManagementSizeInChunk(memoryManager.getChunkManagementLayout());
     dest = MemPoolInfoContainer(numOfMemPools, MemPoolInfo());
     for (uint32_t i = 0; i < numOfMemPools; ++i)
     {
@@ -194,7 +198,20 @@ void MemPoolIntrospection<MemoryManager, SegmentManager, SenderPort>::copyMemPoo
         dst.m_minFreeChunks = src.m_minFreeChunks;
         dst.m_numChunks = src.m_numChunks;
         dst.m_chunkSize = src.m_chunkSize;
-        dst.m_payloadSize = src.m_chunkSize - static_cast<uint32_t>(sizeof(mepoo::ChunkHeader));
+        dst.m_payloadSize = src.m_chunkSize - static_cast<uint32_t>(sizeof(mepoo::ChunkHeader)) - chunkManagementSize;
+        dst.m_stashedChunks = src.m_stashedChunks;
+        dst.m_maxRequestedPayloadSize = src.m_maxRequestedPayloadSize;
+    }
+}
+
+template <typename MemoryManager, typename SegmentManager, typename SenderPort>
+void MemPoolIntrospection<MemoryManager, SegmentManager, SenderPort>::copyAllocationProfile(
+    const MemoryManager& memoryManager, MemPoolIntrospectionInfo& dest) noexcept
+{
+    dest.m_isAllocationProfileRecorded = memoryManager.isAllocationProfileRecorded();
+    for (uint32_t bucket = 0u; bucket < mepoo::ALLOCATION_PROFILE_NUMBER_OF_BUCKETS; ++bucket)
+    {
+        dest.m_requestedPayloadSizes[bucket] = memoryManager.getRequestedPayloadSizeCount(bucket);
     }
 }
 
@@ -41,12 +41,14 @@ class RouDiProcess
     /// application
     /// @param [in] name of the process; this is equal to the mqueue name, which is used for communication
     /// @param [in] pid is the host system process id
+    /// @param [in] user is the posix user id to which the process belongs
     /// @param [in] payloadMemoryManager is a pointer to the payload memory manager for this process
     /// @param [in] isMonitored indicates if the process should be monitored for being alive
     /// @param [in] payloadSegmentId is an identifier for the shm payload segment
     /// @param [in] sessionId is an ID generated by RouDi to prevent sending outdated mqueue transmission
     RouDiProcess(const ProcessName_t& name,
                  int32_t pid,
+                 posix::PosixUser user,
                  mepoo::MemoryManager* payloadMemoryManager,
                  bool isMonitored,
                  const uint64_t payloadSegmentId,
@@ -63,6 +65,8 @@ class RouDiProcess
 
     const ProcessName_t getName() const noexcept;
 
+    posix::PosixUser getUser() const noexcept;
+
     void sendToMQ(const runtime::MqMessage& data) noexcept;
 
     /// @brief The session ID which is used to check outdated mqueue transmissions for this process
@@ -80,6 +84,7 @@ class RouDiProcess
 
   private:
     int m_pid;
+    posix::PosixUser m_user;
     runtime::MqInterfaceUser m_mq;
     mepoo::TimePointNs m_timestamp;
     mepoo::MemoryManager* m_payloadMemoryManager{nullptr};
@@ -193,6 +198,7 @@ class ProcessManager : public ProcessManagerInterface
 
     /// @param [in] name of the process; this is equal to the mqueue name, which is used for communication
     /// @param [in] pid is the host system process id
+    /// @param [in] user is the posix user id to which the process belongs
     /// @param [in] payloadMemoryManager is a pointer to the payload memory manager for this process
     /// @param [in] isMonitored indicates if the process should be monitored for being alive
     /// @param [in] transmissionTimestamp is an ID for the application to check for the expected response
@@ -202,6 +208,7 @@ class ProcessManager : public ProcessManagerInterface
     /// @return Returns if the process could be added successfully.
     bool addProcess(const ProcessName_t& name,
                     int32_t pid,
+                    posix::PosixUser user,
                     mepoo::MemoryManager* payloadMemoryManager,
                     bool isMonitored,
                     int64_t transmissionTimestamp,
@@ -209,6 +216,13 @@ class ProcessManager : public ProcessManagerInterface
                     const uint64_t sessionId,
                     const version::VersionInfo& versionInfo) noexcept;
 
+    /// @brief Provides the payload memory manager for a new port of a process
+    /// @param [in] process which requests the port
+    /// @param [in] portConfigInfo of the port; if it requests a NUMA node, the segment on this node is preferred
+    /// @return the memory manager of the payload segment for the port
+    mepoo::MemoryManager* getPayloadMemoryManager(const RouDiProcess& process,
+                                                  const PortConfigInfo& portConfigInfo) const noexcept;
+
     /// @brief Removes the process from the managed client process list, identified by its id.
     /// @param [in] name The process name which should be removed.
     /// @return Returns true if the process was found and removed from the internal list.
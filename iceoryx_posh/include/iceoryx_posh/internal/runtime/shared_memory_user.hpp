@@ -36,10 +36,12 @@ class SharedMemoryUser
     /// @param[in] segmentManagerAddr adress of the segment manager that does the final mapping of memory in the process
     /// @param[in] segmentId of the relocatable shared memory segment
     /// address space
+    /// @param[in] pageFaultPolicy policy for the management segment and minimal policy for the payload segments
     SharedMemoryUser(const bool doMapSharedMemoryIntoThread,
                      const size_t topicSize,
                      std::string segmentManagerAddr,
-                     const uint64_t segmentId);
+                     const uint64_t segmentId,
+                     const posix::PageFaultPolicy pageFaultPolicy = posix::PageFaultPolicy::onDemand);
 
   private:
     cxx::optional<posix::SharedMemoryObject> m_shmObject;
@@ -15,6 +15,7 @@
 #define IOX_POSH_MEPOO_MEMORY_INFO_HPP
 
 #include <cstdint>
+#include <limits>
 
 namespace iox
 {
@@ -26,6 +27,10 @@ struct MemoryInfo
 {
     static constexpr uint32_t DEFAULT_DEVICE_ID{0u};
     static constexpr uint32_t DEFAULT_MEMORY_TYPE{0u};
+    /// the memory is not bound to a NUMA node
+    static constexpr uint32_t ANY_NUMA_NODE{std::numeric_limits<uint32_t>::max()};
+    /// the NUMA node of the CPU on which the thread runs, which requests a port; resolved by the runtime
+    static constexpr uint32_t LOCAL_NUMA_NODE{std::numeric_limits<uint32_t>::max() - 1u};
 
     // These are intentionally not defined as enum classes for flexibility and extendibility.
     // Currently only the defaults are used.
@@ -34,6 +39,7 @@ struct MemoryInfo
 
     uint32_t deviceId{DEFAULT_DEVICE_ID};
     uint32_t memoryType{DEFAULT_MEMORY_TYPE};
+    uint32_t numaNode{ANY_NUMA_NODE};
 
     MemoryInfo(const MemoryInfo&) = default;
     MemoryInfo(MemoryInfo&&) = default;
@@ -43,7 +49,10 @@ struct MemoryInfo
     /// @brief creates a MemoryInfo object
     /// @param[in] deviceId specifies the device where the memory is located
     /// @param[in] memoryType encodes additional information about the memory
-    MemoryInfo(uint32_t deviceId = DEFAULT_DEVICE_ID, uint32_t memoryType = DEFAULT_MEMORY_TYPE);
+    /// @param[in] numaNode specifies the NUMA node on which the memory is located
+    MemoryInfo(uint32_t deviceId = DEFAULT_DEVICE_ID,
+               uint32_t memoryType = DEFAULT_MEMORY_TYPE,
+               uint32_t numaNode = ANY_NUMA_NODE);
 };
 } // namespace mepoo
 } // namespace iox
@@ -27,23 +27,58 @@ class PortManager;
 }
 namespace mepoo
 {
+/// @brief number of buckets of the payload size histogram of an allocation profile, one for every power of two a
+/// uint32_t size is able to reach including 2^0; the bucket k counts the payload sizes s with 2^(k-1) < s <= 2^k
+constexpr uint32_t ALLOCATION_PROFILE_NUMBER_OF_BUCKETS{33u};
+
+/// @brief defines what happens if the smallest mempool which fits a requested payload size has no free chunk left
+enum class MemPoolFallbackPolicy : uint8_t
+{
+    /// the allocation fails
+    STRICT,
+    /// the chunk is taken from the next larger mempool
+    NEXT_LARGER,
+    /// the chunk is taken from the smallest larger mempool which has a free chunk
+    ANY_LARGER
+};
+
+/// @brief defines where the ChunkManagement with the reference counter of a chunk is stored
+enum class ChunkManagementLayout : uint8_t
+{
+    /// the ChunkManagement is taken from a separate pool in the management memory
+    SEPARATE_POOL,
+    /// the ChunkManagement is stored in a reserved area in front of the ChunkHeader within the chunk itself; this
+    /// saves the second free list access on every allocation and release, but every user of the chunk must have write
+    /// access to the payload memory to update the reference counter
+    IN_CHUNK
+};
+
 struct MePooConfig
 {
   public:
     struct Entry
     {
         /// @brief set the size and count of memory chunks
-        Entry(uint32_t f_size, uint32_t f_chunkCount) noexcept
+        /// @param[in] f_chunkMagazineCount number of publishers which are able to use a chunk magazine on this
+        /// mempool concurrently, 0 means that no memory is reserved for chunk magazines
+        Entry(uint32_t f_size, uint32_t f_chunkCount, uint32_t f_chunkMagazineCount = 0u) noexcept
             : m_size(f_size)
             , m_chunkCount(f_chunkCount)
+            , m_chunkMagazineCount(f_chunkMagazineCount)
         {
         }
         uint32_t m_size{0};
         uint32_t m_chunkCount{0};
+        uint32_t m_chunkMagazineCount{0};
     };
 
     using MePooConfigContainerType = cxx::vector<Entry, MAX_NUMBER_OF_MEMPOOLS>;
     MePooConfigContainerType m_mempoolConfig;
+    MemPoolFallbackPolicy m_fallbackPolicy{MemPoolFallbackPolicy::STRICT};
+    ChunkManagementLayout m_chunkManagementLayout{ChunkManagementLayout::SEPARATE_POOL};
+    /// records a histogram of the requested payload sizes and the largest payload size requested from every mempool,
+    /// this costs an atomic operation per allocation and is meant to tune the mempool configuration
+    bool m_recordAllocationProfile{false};
 
     /// @brief Default constructor to set the configuration for memory pools
     MePooConfig() = default;
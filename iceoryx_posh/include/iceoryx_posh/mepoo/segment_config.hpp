@@ -19,6 +19,7 @@
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_utils/cxx/vector.hpp"
+#include "iceoryx_utils/internal/posix_wrapper/shared_memory_object/shared_memory.hpp"
 #include "iceoryx_utils/posix_wrapper/posix_access_rights.hpp"
 
 namespace iox
@@ -32,11 +33,15 @@ struct SegmentConfig
         SegmentEntry(const posix::PosixGroup::string_t& readerGroup,
                      const posix::PosixGroup::string_t& writerGroup,
                      const MePooConfig& memPoolConfig,
-                     iox::mepoo::MemoryInfo memoryInfo = iox::mepoo::MemoryInfo())
+                     iox::mepoo::MemoryInfo memoryInfo = iox::mepoo::MemoryInfo(),
+                     const posix::PageType pageType = posix::PageType::normal,
+                     const posix::PageFaultPolicy pageFaultPolicy = posix::PageFaultPolicy::onDemand)
             : m_readerGroup(readerGroup)
             , m_writerGroup(writerGroup)
             , m_mempoolConfig(memPoolConfig)
             , m_memoryInfo(memoryInfo)
+            , m_pageType(pageType)
+            , m_pageFaultPolicy(pageFaultPolicy)
 
         {
         }
@@ -45,6 +50,8 @@ struct SegmentConfig
         posix::PosixGroup::string_t m_writerGroup;
         MePooConfig m_mempoolConfig;
         iox::mepoo::MemoryInfo m_memoryInfo;
+        posix::PageType m_pageType{posix::PageType::normal};
+        posix::PageFaultPolicy m_pageFaultPolicy{posix::PageFaultPolicy::onDemand};
     };
 
     cxx::vector<SegmentEntry, MAX_SHM_SEGMENTS> m_sharedMemorySegments;
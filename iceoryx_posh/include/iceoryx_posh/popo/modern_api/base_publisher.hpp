@@ -19,6 +19,7 @@
 #include "iceoryx_posh/popo/modern_api/sample.hpp"
 #include "iceoryx_utils/cxx/expected.hpp"
 #include "iceoryx_utils/cxx/optional.hpp"
+#include "iceoryx_utils/cxx/vector.hpp"
 
 namespace iox
 {
@@ -47,6 +48,8 @@ template <typename T, typename port_t = iox::PublisherPortUserType>
 class BasePublisher : public PublisherInterface<T>
 {
   protected:
+    using SampleBatch_t = cxx::vector<Sample<T>, MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY>;
+
     BasePublisher(const BasePublisher& other) = delete;
     BasePublisher& operator=(const BasePublisher&) = delete;
     BasePublisher(BasePublisher&& rhs) = default;
@@ -74,12 +77,29 @@ class BasePublisher : public PublisherInterface<T>
     ///
     cxx::expected<Sample<T>, AllocationError> loan(const uint32_t size) noexcept;
 
+    ///
+    /// @brief loanN Get multiple samples from loaned shared memory at once.
+    /// @param numberOfSamples The number of samples to loan, at most MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY.
+    /// @param size The expected size of each sample.
+    /// @return The samples that reside in shared memory or an error if unable to allocate all of them, in this case
+    /// none is loaned.
+    /// @details The chunks are taken with batched pops from the mempools instead of one pop per sample.
+    ///
+    cxx::expected<SampleBatch_t, AllocationError> loanN(const uint32_t numberOfSamples, const uint32_t size) noexcept;
+
     ///
     /// @brief publish Publishes the given sample and then releases its loan.
     /// @param sample The sample to publish.
     ///
     void publish(Sample<T>&& sample) noexcept override;
 
+    ///
+    /// @brief publishN Publishes the given samples in their order with a single delivery pass and then releases their
+    /// loans.
+    /// @param samples The samples to publish, the container is empty afterwards.
+    ///
+    void publishN(SampleBatch_t&& samples) noexcept;
+
     ///
     /// @brief previousSample Retrieve the previously loaned sample if it has not yet been claimed.
     /// @return The previously loaned sample if retrieved.
@@ -108,6 +128,17 @@ class BasePublisher : public PublisherInterface<T>
     ///
     bool hasSubscribers() const noexcept;
 
+    ///
+    /// @brief setChunkMagazineBatchSize Lets the publisher take chunks in batches from the mempools to reduce the
+    /// contention on the mempools when many publishers loan concurrently.
+    /// @param batchSize Number of chunks which are taken at once, 0 disables the magazines (default).
+    /// @note Stashed chunks are not available to other publishers until the mempool runs empty.
+    /// @note Only the allocation is batched. Releasing a chunk still returns it directly to the free list of its
+    /// mempool, since the last owner of a chunk is usually a subscriber in another process which has no magazine.
+    /// The stashed chunks are returned in one batch when the magazine is flushed.
+    ///
+    void setChunkMagazineBatchSize(const uint32_t batchSize) noexcept;
+
   protected:
     BasePublisher() = default; // Required for testing.
     BasePublisher(const capro::ServiceDescription& service);
@@ -21,6 +21,7 @@
 #include "iceoryx_utils/cxx/expected.hpp"
 #include "iceoryx_utils/cxx/optional.hpp"
 #include "iceoryx_utils/cxx/unique_ptr.hpp"
+#include "iceoryx_utils/cxx/vector.hpp"
 
 namespace iox
 {
@@ -32,6 +33,8 @@ template <typename T, typename port_t = iox::SubscriberPortUserType>
 class BaseSubscriber : public Condition
 {
   protected:
+    using SampleBatch_t = cxx::vector<Sample<const T>, MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY>;
+
     BaseSubscriber(const capro::ServiceDescription& service);
     BaseSubscriber(const BaseSubscriber& other) = delete;
     BaseSubscriber& operator=(const BaseSubscriber&) = delete;
@@ -98,6 +101,13 @@ class BaseSubscriber : public Condition
     ///
     void releaseQueuedSamples() noexcept;
 
+    ///
+    /// @brief releaseN Releases the loans of multiple samples at once.
+    /// @param samples The samples to release, the batch is empty afterwards.
+    /// @details The underlying memory chunks are removed from the chunks held by the subscriber in a single pass.
+    ///
+    void releaseN(SampleBatch_t&& samples) noexcept;
+
     // Condition overrides
     virtual void setConditionVariable(ConditionVariableData* const conditionVariableDataPtr) noexcept override;
     virtual void unsetConditionVariable() noexcept override;
@@ -99,6 +99,12 @@ class Sample<const T>
     const T* get() noexcept;
     const mepoo::ChunkHeader* getHeader() noexcept;
 
+    ///
+    /// @brief release Manually release ownership of the received memory chunk.
+    /// @details This prevents the sample from automatically releasing ownership on destruction.
+    ///
+    void release() noexcept;
+
   private:
     cxx::unique_ptr<T> m_samplePtr{[](T* const) {}}; // Placeholder. This is overwritten on sample construction.
 };
@@ -30,6 +30,8 @@ class TypedPublisher : public base_publisher_t
     static_assert(std::is_default_constructible<T>::value, "The TypedPublisher requires default-constructable types.");
 
   public:
+    using SampleBatch_t = typename base_publisher_t::SampleBatch_t;
+
     TypedPublisher(const capro::ServiceDescription& service);
     TypedPublisher(const TypedPublisher& other) = delete;
     TypedPublisher& operator=(const TypedPublisher&) = delete;
@@ -44,10 +46,18 @@ class TypedPublisher : public base_publisher_t
     using base_publisher_t::loanPreviousSample;
     using base_publisher_t::offer;
     using base_publisher_t::publish;
+    using base_publisher_t::publishN;
+    using base_publisher_t::setChunkMagazineBatchSize;
     using base_publisher_t::stopOffer;
 
     cxx::expected<Sample<T>, AllocationError> loan() noexcept;
     ///
+    /// @brief loanN Loan multiple default constructed samples at once.
+    /// @param numberOfSamples The number of samples to loan.
+    /// @return The samples or an error if unable to allocate all of them.
+    ///
+    cxx::expected<SampleBatch_t, AllocationError> loanN(const uint32_t numberOfSamples) noexcept;
+    ///
     /// @brief publishCopyOf Copy the provided value into a loaned shared memory chunk and publish it.
     /// @param val Value to copy.
     /// @return Error if unable to allocate memory to loan.
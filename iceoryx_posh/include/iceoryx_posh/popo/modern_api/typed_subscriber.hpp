@@ -27,6 +27,8 @@ class TypedSubscriber : public base_subscriber_t
     static_assert(!std::is_void<T>::value, "Type must not be void. Use the UntypedSubscriber for void types.");
 
   public:
+    using SampleBatch_t = typename base_subscriber_t::SampleBatch_t;
+
     TypedSubscriber(const capro::ServiceDescription& service);
     TypedSubscriber(const TypedSubscriber& other) = delete;
     TypedSubscriber& operator=(const TypedSubscriber&) = delete;
@@ -40,6 +42,7 @@ class TypedSubscriber : public base_subscriber_t
     using base_subscriber_t::hasMissedSamples;
     using base_subscriber_t::hasNewSamples;
     using base_subscriber_t::hasTriggered;
+    using base_subscriber_t::releaseN;
     using base_subscriber_t::releaseQueuedSamples;
     using base_subscriber_t::setConditionVariable;
     using base_subscriber_t::subscribe;
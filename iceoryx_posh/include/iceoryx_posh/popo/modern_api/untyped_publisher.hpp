@@ -26,6 +26,8 @@ template <typename base_publisher_t = BasePublisher<void>>
 class UntypedPublisherImpl : public base_publisher_t
 {
   public:
+    using SampleBatch_t = typename base_publisher_t::SampleBatch_t;
+
     UntypedPublisherImpl(const capro::ServiceDescription& service);
     UntypedPublisherImpl(const UntypedPublisherImpl& other) = delete;
     UntypedPublisherImpl& operator=(const UntypedPublisherImpl&) = delete;
@@ -38,9 +40,12 @@ class UntypedPublisherImpl : public base_publisher_t
     using base_publisher_t::hasSubscribers;
     using base_publisher_t::isOffered;
     using base_publisher_t::loan;
+    using base_publisher_t::loanN;
     using base_publisher_t::loanPreviousSample;
     using base_publisher_t::offer;
     using base_publisher_t::publish;
+    using base_publisher_t::publishN;
+    using base_publisher_t::setChunkMagazineBatchSize;
     using base_publisher_t::stopOffer;
 
     ///
@@ -28,6 +28,8 @@ template <typename base_subscriber_t = BaseSubscriber<void>>
 class UntypedSubscriberImpl : public base_subscriber_t
 {
   public:
+    using SampleBatch_t = typename base_subscriber_t::SampleBatch_t;
+
     UntypedSubscriberImpl(const capro::ServiceDescription& service);
     UntypedSubscriberImpl(const UntypedSubscriberImpl& other) = delete;
     UntypedSubscriberImpl& operator=(const UntypedSubscriberImpl&) = delete;
@@ -41,6 +43,7 @@ class UntypedSubscriberImpl : public base_subscriber_t
     using base_subscriber_t::hasMissedSamples;
     using base_subscriber_t::hasNewSamples;
     using base_subscriber_t::hasTriggered;
+    using base_subscriber_t::releaseN;
     using base_subscriber_t::releaseQueuedSamples;
     using base_subscriber_t::setConditionVariable;
     using base_subscriber_t::subscribe;
@@ -38,6 +38,9 @@ struct MemPoolInfo
     uint32_t m_numChunks{0};
     uint32_t m_chunkSize{0};
     uint32_t m_payloadSize{0};
+    uint32_t m_stashedChunks{0};
+    /// largest payload size which was served by the mempool, only set if the allocation profile is recorded
+    uint32_t m_maxRequestedPayloadSize{0};
 };
 
 /// @brief container for MemPoolInfo structs of all available mempools.
@@ -50,6 +53,9 @@ struct MemPoolIntrospectionInfo
     char m_writerGroupName[MAX_GROUP_NAME_LENGTH];
     char m_readerGroupName[MAX_GROUP_NAME_LENGTH];
     MemPoolInfoContainer m_mempoolInfo;
+    bool m_isAllocationProfileRecorded{false};
+    /// histogram of the requested payload sizes, see mepoo::ALLOCATION_PROFILE_NUMBER_OF_BUCKETS
+    uint64_t m_requestedPayloadSizes[mepoo::ALLOCATION_PROFILE_NUMBER_OF_BUCKETS]{};
 };
 
 /// @brief container for MemPoolInfo structs of all available mempools.
@@ -38,9 +38,14 @@ class PosixShmMemoryProvider : public MemoryProvider
     /// @param [in] accessMode defines the read and write access to the memory
     /// @param [in] ownership defines the ownership of the shared memory. "mine" controls the lifetime of the memory and
     /// "openExisting" will just use an already existing shared memory
+    /// @param [in] pageType defines whether the memory shall be backed by huge pages, if they are not available the
+    /// memory is backed by normal pages
+    /// @param [in] pageFaultPolicy defines whether the pages of the memory are mapped on creation and locked into RAM
     PosixShmMemoryProvider(const ShmNameString& shmName,
                            const posix::AccessMode accessMode,
-                           const posix::OwnerShip ownership) noexcept;
+                           const posix::OwnerShip ownership,
+                           const posix::PageType pageType = posix::PageType::normal,
+                           const posix::PageFaultPolicy pageFaultPolicy = posix::PageFaultPolicy::onDemand) noexcept;
     ~PosixShmMemoryProvider() noexcept;
 
     PosixShmMemoryProvider(PosixShmMemoryProvider&&) = delete;
@@ -65,6 +70,8 @@ class PosixShmMemoryProvider : public MemoryProvider
     ShmNameString m_shmName;
     posix::AccessMode m_accessMode{posix::AccessMode::readOnly};
     posix::OwnerShip m_ownership{posix::OwnerShip::openExisting};
+    posix::PageType m_pageType{posix::PageType::normal};
+    posix::PageFaultPolicy m_pageFaultPolicy{posix::PageFaultPolicy::onDemand};
     cxx::optional<posix::SharedMemoryObject> m_shmObject;
 };
 
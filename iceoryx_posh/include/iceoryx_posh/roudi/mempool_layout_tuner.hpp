@@ -0,0 +1,49 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef IOX_POSH_ROUDI_MEMPOOL_LAYOUT_TUNER_HPP
+#define IOX_POSH_ROUDI_MEMPOOL_LAYOUT_TUNER_HPP
+
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iceoryx_posh/roudi/introspection_types.hpp"
+
+#include <cstdint>
+#include <ostream>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief suggests the mempools of a segment from the mempool introspection data which was recorded while the system
+/// was under its usual load. Every mempool gets the peak number of chunks in use plus the headroom; mempools which
+/// were never used are dropped. If the allocation profile was recorded, the payload size of a mempool is shrunk to
+/// the largest payload size which was served by it.
+/// @param[in] f_recording the mempool introspection data of the segment
+/// @param[in] f_headroomPercent additional chunks in percent of the peak number of chunks in use
+/// @return the suggested mempools, ordered by increasing size
+mepoo::MePooConfig suggestMePooConfig(const MemPoolIntrospectionInfo& f_recording,
+                                      const uint32_t f_headroomPercent) noexcept;
+
+/// @brief writes the suggested mempools of a segment as [[segment]] entry of the RouDi config file, the recorded
+/// histogram of the requested payload sizes and the memory savings are added as comments
+/// @param[in] f_stream the stream to write to
+/// @param[in] f_recording the mempool introspection data of the segment
+/// @param[in] f_suggestion the mempools which were suggested for the recording
+void writeMemPoolLayout(std::ostream& f_stream,
+                        const MemPoolIntrospectionInfo& f_recording,
+                        const mepoo::MePooConfig& f_suggestion) noexcept;
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_MEMPOOL_LAYOUT_TUNER_HPP
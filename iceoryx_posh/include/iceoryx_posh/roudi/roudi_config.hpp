@@ -15,6 +15,7 @@
 #define IOX_POSH_ROUDI_ROUDI_CONFIG_HPP
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_utils/internal/posix_wrapper/shared_memory_object/shared_memory.hpp"
 
 #include <cstdint>
 
@@ -26,6 +27,9 @@ struct RouDiConfig
 {
     RouDiConfig& setDefaults();
     RouDiConfig& optimize();
+
+    /// defines whether the pages of the management segment are mapped on creation and locked into RAM
+    posix::PageFaultPolicy m_managementPageFaultPolicy{posix::PageFaultPolicy::onDemand};
 };
 } // namespace config
 } // namespace iox
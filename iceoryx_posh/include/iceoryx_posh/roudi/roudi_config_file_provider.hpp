@@ -32,6 +32,8 @@ namespace roudi
 /// MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED - the max number of mempools per segment is exceeded
 /// MEMPOOL_WITHOUT_CHUNK_SIZE - chunk size not specified for the mempool
 /// MEMPOOL_WITHOUT_CHUNK_COUNT - chunk count not specified for the mempool
+/// INVALID_CHUNK_MANAGEMENT_LAYOUT - unknown chunk management layout or in-chunk layout for a segment whose readers
+/// have no write access
 enum class RouDiConfigFileParseError
 {
     NO_GENERAL_SECTION,
@@ -42,6 +44,9 @@ enum class RouDiConfigFileParseError
     MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED,
     MEMPOOL_WITHOUT_CHUNK_SIZE,
     MEMPOOL_WITHOUT_CHUNK_COUNT,
+    MAX_NUMBER_OF_CHUNK_MAGAZINES_PER_MEMPOOL_EXCEEDED,
+    INVALID_MEMPOOL_FALLBACK_POLICY,
+    INVALID_CHUNK_MANAGEMENT_LAYOUT,
 };
 
 constexpr const char* ROUDI_CONFIG_FILE_PARSE_ERROR_STRINGS[] = {"NO_GENERAL_SECTION",
@@ -51,7 +56,10 @@ constexpr const char* ROUDI_CONFIG_FILE_PARSE_ERROR_STRINGS[] = {"NO_GENERAL_SEC
                                                                  "SEGMENT_WITHOUT_MEMPOOL",
                                                                  "MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED",
                                                                  "MEMPOOL_WITHOUT_CHUNK_SIZE",
-                                                                 "MEMPOOL_WITHOUT_CHUNK_COUNT"};
+                                                                 "MEMPOOL_WITHOUT_CHUNK_COUNT",
+                                                                 "MAX_NUMBER_OF_CHUNK_MAGAZINES_PER_MEMPOOL_EXCEEDED",
+                                                                 "INVALID_MEMPOOL_FALLBACK_POLICY",
+                                                                 "INVALID_CHUNK_MANAGEMENT_LAYOUT"};
 
 /// @brief Base class for a config file provider.
 class RouDiConfigFileProvider
@@ -48,9 +48,12 @@ struct PortConfigInfo
     /// @param[in] portType specifies the type of port to be created
     /// @param[in] deviceId specifies the device the port operates on (CPU, GPUx etc.)
     /// @param[in] memoryType encodes additional information about the memory used by the port
+    /// @param[in] numaNode specifies the NUMA node of the payload segment which is preferred by a publisher, with
+    /// mepoo::MemoryInfo::LOCAL_NUMA_NODE the node of the CPU on which the port is requested is used
     PortConfigInfo(uint32_t portType = DEFAULT_PORT_TYPE,
                    uint32_t deviceId = DEFAULT_DEVICE_ID,
-                   uint32_t memoryType = DEFAULT_MEMORY_TYPE) noexcept;
+                   uint32_t memoryType = DEFAULT_MEMORY_TYPE,
+                   uint32_t numaNode = mepoo::MemoryInfo::ANY_NUMA_NODE) noexcept;
 
     /// @brief creates a PortConfigInfo object from its serialization
     /// @param[in] serialization specifies the serialization from which the port is created
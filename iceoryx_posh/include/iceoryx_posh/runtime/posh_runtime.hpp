@@ -55,6 +55,13 @@ class PoshRuntime
     /// @param[in] name name that is used for registering the process with the RouDi daemon
     static PoshRuntime& getInstance(const ProcessName_t& name = defaultRuntimeInstanceName()) noexcept;
 
+    /// @brief sets how the application maps the shared memory; with PageFaultPolicy::prefault all pages of the
+    /// management and payload segments are mapped when the runtime is created, with PageFaultPolicy::lock they are
+    /// additionally locked into RAM. A payload segment keeps the policy of the RouDi config if that one is stronger.
+    /// @param[in] pageFaultPolicy the policy for the mappings of this application, PageFaultPolicy::onDemand is default
+    /// @note has to be called before the first call of getInstance
+    static void setPageFaultPolicy(const posix::PageFaultPolicy pageFaultPolicy) noexcept;
+
     /// @brief get the name that was used to register with RouDi
     /// @return name of the reistered application
     ProcessName_t getInstanceName() const noexcept;
@@ -174,6 +181,8 @@ class PoshRuntime
 
     static ProcessName_t& defaultRuntimeInstanceName() noexcept;
 
+    static posix::PageFaultPolicy& pageFaultPolicy() noexcept;
+
   private:
     /// @deprecated #25
     cxx::expected<SenderPortType::MemberType_t*, MqMessageErrorType>
@@ -0,0 +1,157 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/internal/mepoo/chunk_magazine.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
+
+#include <algorithm>
+
+namespace iox
+{
+namespace mepoo
+{
+constexpr uint32_t ChunkMagazine::CAPACITY;
+
+void ChunkMagazine::setBatchSize(const uint32_t batchSize) noexcept
+{
+    flush();
+    m_batchSize = std::min(batchSize, CAPACITY);
+}
+
+uint32_t ChunkMagazine::getBatchSize() const noexcept
+{
+    return m_batchSize;
+}
+
+uint64_t ChunkMagazine::getOwnerId() const noexcept
+{
+    RelativePointer position(const_cast<ChunkMagazine*>(this));
+    return (static_cast<uint64_t>(position.getId()) << 48U) ^ static_cast<uint64_t>(position.getOffset());
+}
+
+bool ChunkMagazine::tryAcquireSlot() noexcept
+{
+    m_memPool->acquireMagazineSlot(getOwnerId()).and_then([this](uint32_t& slot) {
+        m_slot = slot;
+        m_hasSlot = true;
+    });
+
+    if (!m_hasSlot && !m_slotShortageReported)
+    {
+        m_slotShortageReported = true;
+        LogWarn() << "All " << m_memPool->getChunkMagazineCount()
+                  << " chunk magazine slots of the mempool with chunk size " << m_memPool->getChunkSize()
+                  << " are in use, allocating without magazine until a slot is free";
+    }
+    return m_hasSlot;
+}
+
+void* ChunkMagazine::getChunk(MemPool& memPool) noexcept
+{
+    if (m_batchSize == 0u || memPool.getChunkMagazineCount() == 0u)
+    {
+        return memPool.getChunk();
+    }
+
+    if (m_memPool != &memPool)
+    {
+        flush();
+        m_memPool = &memPool;
+    }
+
+    if (!m_hasSlot && !tryAcquireSlot())
+    {
+        return memPool.getChunk();
+    }
+
+    void* chunk = memPool.takeFromMagazineSlot(m_slot);
+    if (chunk == nullptr && memPool.refillMagazineSlot(m_slot, m_batchSize) > 0u)
+    {
+        chunk = memPool.takeFromMagazineSlot(m_slot);
+    }
+
+    // the free list is empty, the MemPool reclaims chunks from the other magazines
+    return (chunk != nullptr) ? chunk : memPool.getChunk();
+}
+
+uint32_t ChunkMagazine::getChunks(MemPool& memPool, void** const chunks, const uint32_t maxNumberOfChunks) noexcept
+{
+    if (m_batchSize == 0u || memPool.getChunkMagazineCount() == 0u)
+    {
+        return memPool.getChunks(chunks, maxNumberOfChunks);
+    }
+
+    if (m_memPool != &memPool)
+    {
+        flush();
+        m_memPool = &memPool;
+    }
+
+    uint32_t numberOfChunks{0u};
+    if (m_hasSlot || tryAcquireSlot())
+    {
+        for (; numberOfChunks < maxNumberOfChunks; ++numberOfChunks)
+        {
+            chunks[numberOfChunks] = memPool.takeFromMagazineSlot(m_slot);
+            if (chunks[numberOfChunks] == nullptr)
+            {
+                break;
+            }
+        }
+    }
+
+    // the stash is not refilled since the remaining chunks are already taken by a batched pop
+    return numberOfChunks + memPool.getChunks(chunks + numberOfChunks, maxNumberOfChunks - numberOfChunks);
+}
+
+void ChunkMagazine::flush() noexcept
+{
+    if (m_memPool == nullptr)
+    {
+        return;
+    }
+
+    // the slot is searched by the owner id since the owner might have terminated after acquiring the slot but before
+    // m_hasSlot was set
+    m_memPool->releaseMagazineSlots(getOwnerId());
+    m_hasSlot = false;
+    m_slotShortageReported = false;
+    m_memPool = nullptr;
+}
+
+uint32_t ChunkMagazine::size() const noexcept
+{
+    return (m_hasSlot) ? m_memPool->getMagazineSlotSize(m_slot) : 0u;
+}
+
+void ChunkMagazines::setBatchSize(const uint32_t batchSize) noexcept
+{
+    for (auto& magazine : m_payload)
+    {
+        magazine.setBatchSize(batchSize);
+    }
+    m_chunkManagement.setBatchSize(batchSize);
+}
+
+void ChunkMagazines::flush() noexcept
+{
+    for (auto& magazine : m_payload)
+    {
+        magazine.flush();
+    }
+    m_chunkManagement.flush();
+}
+
+} // namespace mepoo
+} // namespace iox
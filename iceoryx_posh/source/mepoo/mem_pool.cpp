@@ -27,10 +27,12 @@ namespace mepoo
 MemPool::MemPool(const cxx::greater_or_equal<uint32_t, MEMORY_ALIGNMENT> f_chunkSize,
                  const cxx::greater_or_equal<uint32_t, 1> f_numberOfChunks,
                  posix::Allocator* f_managementAllocator,
-                 posix::Allocator* f_payloadAllocator)
+                 posix::Allocator* f_payloadAllocator,
+                 const uint32_t f_numberOfChunkMagazines)
     : m_chunkSize(f_chunkSize)
     , m_numberOfChunks(f_numberOfChunks)
     , m_minFree(f_numberOfChunks)
+    , m_numberOfMagazineSlots(f_numberOfChunkMagazines)
 {
     if (isMultipleOfAlignment(f_chunkSize))
     {
@@ -39,6 +41,18 @@ MemPool::MemPool(const cxx::greater_or_equal<uint32_t, MEMORY_ALIGNMENT> f_chunk
         auto memoryLoFFLi =
             static_cast<uint32_t*>(f_managementAllocator->allocate(freeList_t::requiredMemorySize(m_numberOfChunks)));
         m_freeIndices.init(memoryLoFFLi, m_numberOfChunks);
+
+        if (m_numberOfMagazineSlots > 0u)
+        {
+            auto memoryMagazineSlots = f_managementAllocator->allocate(
+                static_cast<uint64_t>(m_numberOfMagazineSlots) * sizeof(MagazineSlot), alignof(MagazineSlot));
+            auto magazineSlots = static_cast<MagazineSlot*>(memoryMagazineSlots);
+            for (uint32_t slot = 0u; slot < m_numberOfMagazineSlots; ++slot)
+            {
+                new (&magazineSlots[slot]) MagazineSlot();
+            }
+            m_magazineSlots = magazineSlots;
+        }
     }
     else
     {
@@ -48,6 +62,16 @@ MemPool::MemPool(const cxx::greater_or_equal<uint32_t, MEMORY_ALIGNMENT> f_chunk
     }
 }
 
+uint64_t MemPool::requiredChunkMagazineMemorySize(const uint32_t f_numberOfChunkMagazines)
+{
+    if (f_numberOfChunkMagazines == 0u)
+    {
+        return 0u;
+    }
+    // the allocator might need up to alignof(MagazineSlot) bytes to align the slots
+    return static_cast<uint64_t>(f_numberOfChunkMagazines) * sizeof(MagazineSlot) + alignof(MagazineSlot);
+}
+
 bool MemPool::isMultipleOfAlignment(const uint32_t value) const
 {
     return (value % SHARED_MEMORY_ALIGNMENT == 0u);
@@ -65,8 +89,14 @@ void* MemPool::getChunk()
     uint32_t l_index{0u};
     if (!m_freeIndices.pop(l_index))
     {
-        std::cerr << "Mempool [m_chunkSize = " << m_chunkSize << ", numberOfChunks = " << m_numberOfChunks
-                  << ", used_chunks = " << m_usedChunks << " ] has no more space left" << std::endl;
+        void* stashedChunk = reclaimStashedChunk();
+        if (stashedChunk != nullptr)
+        {
+            return stashedChunk;
+        }
+
+        // an empty mempool is not an error by itself, e.g. the MemoryManager might fall back to a larger mempool;
+        // the caller reports the failure if no chunk could be acquired at all
         return nullptr;
     }
 
@@ -78,6 +108,44 @@ void* MemPool::getChunk()
     return m_rawMemory + l_index * m_chunkSize;
 }
 
+uint32_t MemPool::getChunks(void** const f_chunks, const uint32_t f_maxNumberOfChunks)
+{
+    uint32_t numberOfChunks{0u};
+    uint32_t indices[CHUNK_MAGAZINE_CAPACITY];
+    while (numberOfChunks < f_maxNumberOfChunks)
+    {
+        const uint32_t numberOfIndices =
+            m_freeIndices.pop(indices, std::min(f_maxNumberOfChunks - numberOfChunks, CHUNK_MAGAZINE_CAPACITY));
+        for (uint32_t i = 0u; i < numberOfIndices; ++i)
+        {
+            f_chunks[numberOfChunks++] = indexToChunk(indices[i]);
+        }
+        if (numberOfIndices == 0u)
+        {
+            break;
+        }
+    }
+
+    if (numberOfChunks > 0u)
+    {
+        m_usedChunks.fetch_add(numberOfChunks, std::memory_order_relaxed);
+        adjustMinFree();
+    }
+
+    // reclaimStashedChunk accounts the used chunks on its own
+    while (numberOfChunks < f_maxNumberOfChunks)
+    {
+        void* stashedChunk = reclaimStashedChunk();
+        if (stashedChunk == nullptr)
+        {
+            break;
+        }
+        f_chunks[numberOfChunks++] = stashedChunk;
+    }
+
+    return numberOfChunks;
+}
+
 void MemPool::freeChunk(const void* chunk)
 {
     cxx::Expects(m_rawMemory <= chunk
@@ -116,12 +184,227 @@ uint32_t MemPool::getMinFree() const
     return m_minFree.load(std::memory_order_relaxed);
 }
 
+uint32_t MemPool::getStashedChunks() const
+{
+    return m_stashedChunks.load(std::memory_order_relaxed);
+}
+
+uint32_t MemPool::getChunkMagazineCount() const
+{
+    return m_numberOfMagazineSlots;
+}
+
 MemPoolInfo MemPool::getInfo() const
 {
     return {m_usedChunks.load(std::memory_order_relaxed),
             m_minFree.load(std::memory_order_relaxed),
             m_numberOfChunks,
-            m_chunkSize};
+            m_chunkSize,
+            m_stashedChunks.load(std::memory_order_relaxed)};
+}
+
+namespace
+{
+constexpr uint64_t MAGAZINE_SLOT_SIZE_MASK{0xFFFFFFFFu};
+constexpr uint64_t MAGAZINE_SLOT_GENERATION_INCREMENT{MAGAZINE_SLOT_SIZE_MASK + 1u};
+
+uint64_t nextGenerationOf(const uint64_t state)
+{
+    return (state & ~MAGAZINE_SLOT_SIZE_MASK) + MAGAZINE_SLOT_GENERATION_INCREMENT;
+}
+} // namespace
+
+void* MemPool::indexToChunk(const uint32_t index) const
+{
+    return m_rawMemory + static_cast<uint64_t>(index) * m_chunkSize;
+}
+
+void MemPool::pushToFreeList(const uint32_t* const indices, const uint32_t numberOfIndices)
+{
+    if (!m_freeIndices.push(indices, numberOfIndices))
+    {
+        errorHandler(Error::kPOSH__MEMPOOL_POSSIBLE_DOUBLE_FREE);
+    }
+}
+
+cxx::optional<uint32_t> MemPool::acquireMagazineSlot(const uint64_t owner)
+{
+    cxx::Expects(owner != 0u);
+    for (uint32_t slot = 0u; slot < m_numberOfMagazineSlots; ++slot)
+    {
+        // the ownership is stored in the slot itself, RouDi finds the slot even if the owner terminates before it
+        // was able to remember the slot index
+        uint64_t expected{0u};
+        if (m_magazineSlots[slot].m_owner.compare_exchange_strong(expected, owner, std::memory_order_acq_rel))
+        {
+            return slot;
+        }
+    }
+    return cxx::nullopt_t();
+}
+
+void MemPool::releaseMagazineSlots(const uint64_t owner)
+{
+    for (uint32_t slot = 0u; slot < m_numberOfMagazineSlots; ++slot)
+    {
+        if (m_magazineSlots[slot].m_owner.load(std::memory_order_acquire) == owner)
+        {
+            flushMagazineSlot(slot);
+            m_magazineSlots[slot].m_owner.store(0u, std::memory_order_release);
+        }
+    }
+}
+
+uint32_t MemPool::getMagazineSlotSize(const uint32_t slot) const
+{
+    cxx::Expects(slot < m_numberOfMagazineSlots);
+    return static_cast<uint32_t>(m_magazineSlots[slot].m_state.load(std::memory_order_relaxed)
+                                 & MAGAZINE_SLOT_SIZE_MASK);
+}
+
+uint64_t MemPool::loadMagazineSlotState(const uint32_t slot) const
+{
+    cxx::Expects(slot < m_numberOfMagazineSlots);
+    return m_magazineSlots[slot].m_state.load(std::memory_order_acquire);
+}
+
+uint32_t MemPool::refillMagazineSlot(const uint32_t slot, const uint32_t batchSize)
+{
+    cxx::Expects(slot < m_numberOfMagazineSlots);
+    auto& magazineSlot = m_magazineSlots[slot];
+
+    const uint32_t maxBatchSize = std::max(1u, m_numberOfChunks / CHUNK_MAGAZINE_SHARE_DIVISOR);
+    const uint32_t numberOfChunks = std::min({batchSize, maxBatchSize, CHUNK_MAGAZINE_CAPACITY});
+
+    uint32_t indices[CHUNK_MAGAZINE_CAPACITY];
+    const uint32_t numberOfStashedChunks = m_freeIndices.pop(indices, numberOfChunks);
+    if (numberOfStashedChunks == 0u)
+    {
+        return 0u;
+    }
+
+    // chunks are taken from the end of the stash, storing them in reverse order hands them out in the order of the
+    // free list; only the owner writes m_indices and it does so only while the stash is empty, a concurrent reclaim
+    // which read an index before the refill fails due to the changed generation
+    for (uint32_t i = 0u; i < numberOfStashedChunks; ++i)
+    {
+        magazineSlot.m_indices[i].store(indices[numberOfStashedChunks - 1u - i], std::memory_order_relaxed);
+    }
+    m_stashedChunks.fetch_add(numberOfStashedChunks, std::memory_order_relaxed);
+    magazineSlot.m_pending.store(numberOfStashedChunks, std::memory_order_release);
+
+    const uint64_t state = magazineSlot.m_state.load(std::memory_order_relaxed);
+    magazineSlot.m_state.store(nextGenerationOf(state) | numberOfStashedChunks, std::memory_order_release);
+    magazineSlot.m_pending.store(0u, std::memory_order_release);
+
+    return numberOfStashedChunks;
+}
+
+void* MemPool::takeFromMagazineSlot(const uint32_t slot)
+{
+    cxx::Expects(slot < m_numberOfMagazineSlots);
+    auto& magazineSlot = m_magazineSlots[slot];
+
+    uint64_t state = magazineSlot.m_state.load(std::memory_order_acquire);
+    uint32_t index{0u};
+    do
+    {
+        const uint32_t size = static_cast<uint32_t>(state & MAGAZINE_SLOT_SIZE_MASK);
+        if (size == 0u)
+        {
+            return nullptr;
+        }
+        index = magazineSlot.m_indices[size - 1u].load(std::memory_order_relaxed);
+    } while (!magazineSlot.m_state.compare_exchange_weak(
+        state, state - 1u, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    m_stashedChunks.fetch_sub(1u, std::memory_order_relaxed);
+    m_usedChunks.fetch_add(1u, std::memory_order_relaxed);
+    adjustMinFree();
+
+    return indexToChunk(index);
+}
+
+void MemPool::flushMagazineSlot(const uint32_t slot)
+{
+    cxx::Expects(slot < m_numberOfMagazineSlots);
+    auto& magazineSlot = m_magazineSlots[slot];
+
+    const uint64_t state = loadMagazineSlotState(slot);
+    uint32_t numberOfChunks{0u};
+    if ((state & MAGAZINE_SLOT_SIZE_MASK) == 0u)
+    {
+        // only the owner refills and flushes, pending chunks next to an empty stash on the first read mean that a
+        // refill or flush of the owner was interrupted by its termination
+        numberOfChunks = magazineSlot.m_pending.load(std::memory_order_acquire);
+    }
+    else
+    {
+        numberOfChunks = detachMagazineSlotChunks(slot, state);
+    }
+
+    if (numberOfChunks == 0u)
+    {
+        return;
+    }
+
+    uint32_t indices[CHUNK_MAGAZINE_CAPACITY];
+    for (uint32_t i = 0u; i < numberOfChunks; ++i)
+    {
+        indices[i] = magazineSlot.m_indices[i].load(std::memory_order_relaxed);
+    }
+
+    // the pending chunks are forgotten before they are pushed, an interruption in between leaks them but never leads
+    // to a double free
+    magazineSlot.m_pending.store(0u, std::memory_order_release);
+    m_stashedChunks.fetch_sub(numberOfChunks, std::memory_order_relaxed);
+    pushToFreeList(indices, numberOfChunks);
+}
+
+uint32_t MemPool::detachMagazineSlotChunks(const uint32_t slot, uint64_t observedState)
+{
+    cxx::Expects(slot < m_numberOfMagazineSlots);
+    auto& magazineSlot = m_magazineSlots[slot];
+
+    // the chunks are recorded as pending before the stash is emptied, if the owner terminates before they are back
+    // in the free list, RouDi finds them in m_pending when it flushes the slot on behalf of the owner
+    while (true)
+    {
+        const uint32_t numberOfChunks = static_cast<uint32_t>(observedState & MAGAZINE_SLOT_SIZE_MASK);
+        if (numberOfChunks == 0u)
+        {
+            // a concurrent reclaim took the remaining chunks, the pending chunks recorded for the previously
+            // observed state are handed out already and must not be returned to the free list
+            magazineSlot.m_pending.store(0u, std::memory_order_release);
+            return 0u;
+        }
+        magazineSlot.m_pending.store(numberOfChunks, std::memory_order_release);
+        if (magazineSlot.m_state.compare_exchange_weak(observedState,
+                                                        nextGenerationOf(observedState),
+                                                        std::memory_order_acq_rel,
+                                                        std::memory_order_acquire))
+        {
+            return numberOfChunks;
+        }
+    }
+}
+
+void* MemPool::reclaimStashedChunk()
+{
+    if (m_stashedChunks.load(std::memory_order_relaxed) == 0u)
+    {
+        return nullptr;
+    }
+
+    for (uint32_t slot = 0u; slot < m_numberOfMagazineSlots; ++slot)
+    {
+        void* chunk = takeFromMagazineSlot(slot);
+        if (chunk != nullptr)
+        {
+            return chunk;
+        }
+    }
+    return nullptr;
 }
 
 } // namespace mepoo
@@ -18,9 +18,13 @@ namespace iox
 {
 namespace mepoo
 {
-MemoryInfo::MemoryInfo(uint32_t deviceId, uint32_t memoryType)
+constexpr uint32_t MemoryInfo::ANY_NUMA_NODE;
+constexpr uint32_t MemoryInfo::LOCAL_NUMA_NODE;
+
+MemoryInfo::MemoryInfo(uint32_t deviceId, uint32_t memoryType, uint32_t numaNode)
     : deviceId(deviceId)
     , memoryType(memoryType)
+    , numaNode(numaNode)
 {
 }
 } // namespace mepoo
@@ -22,28 +22,73 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <limits>
 
 namespace iox
 {
 namespace mepoo
 {
+constexpr uint32_t MemoryManager::NUMBER_OF_SIZE_CLASSES;
+
+static_assert(sizeof(ChunkManagement) % MemPool::MEMORY_ALIGNMENT == 0,
+              "the ChunkManagement in front of the ChunkHeader must keep the ChunkHeader aligned");
+
+namespace
+{
+/// @brief returns the size class of a chunk size, which is the number of bits required to represent f_chunkSize - 1
+uint32_t sizeClassOf(const uint32_t f_chunkSize)
+{
+    uint32_t value = (f_chunkSize > 0u) ? f_chunkSize - 1u : 0u;
+    uint32_t numberOfBits{0u};
+    for (uint32_t shift = 16u; shift > 0u; shift /= 2u)
+    {
+        if ((value >> shift) != 0u)
+        {
+            value >>= shift;
+            numberOfBits += shift;
+        }
+    }
+    return numberOfBits + value;
+}
+} // namespace
+
+uint32_t MemoryManager::chunkManagementSizeInChunk(const ChunkManagementLayout f_layout)
+{
+    return (f_layout == ChunkManagementLayout::IN_CHUNK) ? static_cast<uint32_t>(sizeof(ChunkManagement)) : 0u;
+}
+
+uint64_t MemoryManager::chunkSizeForPayloadSize(const uint64_t f_payloadSize) const
+{
+    return f_payloadSize + sizeof(ChunkHeader) + chunkManagementSizeInChunk(m_chunkManagementLayout);
+}
+
 void MemoryManager::printMemPoolVector() const
 {
+    const uint32_t chunkManagementSize = chunkManagementSizeInChunk(m_chunkManagementLayout);
     for (auto& l_mempool : m_memPoolVector)
     {
         std::cerr << "  MemPool [ ChunkSize = " << l_mempool.getChunkSize()
-                  << ", PayloadSize = " << l_mempool.getChunkSize() - sizeof(ChunkHeader)
-                  << ", ChunkCount = " << l_mempool.getChunkCount() << " ]" << std::endl;
+                  << ", PayloadSize = " << l_mempool.getChunkSize() - sizeof(ChunkHeader) - chunkManagementSize
+                  << ", ChunkCount = " << l_mempool.getChunkCount()
+                  << ", UsedChunks = " << l_mempool.getInfo().m_usedChunks << " ]" << std::endl;
     }
 }
 
 void MemoryManager::addMemPool(posix::Allocator* f_managementAllocator,
                                posix::Allocator* f_payloadAllocator,
                                const cxx::greater_or_equal<uint32_t, MemPool::MEMORY_ALIGNMENT> f_payloadSize,
-                               const cxx::greater_or_equal<uint32_t, 1> f_numberOfChunks)
+                               const cxx::greater_or_equal<uint32_t, 1> f_numberOfChunks,
+                               const uint32_t f_numberOfChunkMagazines)
 {
-    uint32_t adjustedChunkSize = sizeWithChunkHeaderStruct(static_cast<uint32_t>(f_payloadSize));
-    if (m_denyAddMemPool)
+    const uint64_t requiredChunkSize = chunkSizeForPayloadSize(static_cast<uint32_t>(f_payloadSize));
+    uint32_t adjustedChunkSize = static_cast<uint32_t>(requiredChunkSize);
+    if (requiredChunkSize > std::numeric_limits<uint32_t>::max())
+    {
+        std::cerr << "The MemPool [ PayloadSize = " << f_payloadSize << " ] requires a chunk size of "
+                  << requiredChunkSize << " which exceeds the maximum chunk size!" << std::endl;
+        errorHandler(Error::kMEPOO__MEMPOOL_CHUNKSIZE_EXCEEDS_MAXIMUM);
+    }
+    else if (m_denyAddMemPool)
     {
         std::cerr
             << "\nAfter the generation of the chunk management pool you are not allowed to create new mempools.\n";
@@ -62,15 +107,56 @@ void MemoryManager::addMemPool(posix::Allocator* f_managementAllocator,
         errorHandler(Error::kMEPOO__MEMPOOL_CONFIG_MUST_BE_ORDERED_BY_INCREASING_SIZE);
     }
 
-    m_memPoolVector.emplace_back(adjustedChunkSize, f_numberOfChunks, f_managementAllocator, f_payloadAllocator);
+    m_memPoolVector.emplace_back(
+        adjustedChunkSize, f_numberOfChunks, f_managementAllocator, f_payloadAllocator, f_numberOfChunkMagazines);
     m_totalNumberOfChunks += f_numberOfChunks;
+    m_maxNumberOfChunkMagazines = std::max(m_maxNumberOfChunkMagazines, f_numberOfChunkMagazines);
 }
 
 void MemoryManager::generateChunkManagementPool(posix::Allocator* f_managementAllocator)
 {
     m_denyAddMemPool = true;
-    uint32_t chunkSize = sizeof(ChunkManagement);
-    m_chunkManagementPool.emplace_back(chunkSize, m_totalNumberOfChunks, f_managementAllocator, f_managementAllocator);
+    // with the IN_CHUNK layout the ChunkManagement is part of the payload chunk and no pool is required
+    if (m_chunkManagementLayout == ChunkManagementLayout::SEPARATE_POOL)
+    {
+        uint32_t chunkSize = sizeof(ChunkManagement);
+        // every publisher with a chunk magazine also stashes chunk management entries
+        m_chunkManagementPool.emplace_back(chunkSize,
+                                           m_totalNumberOfChunks,
+                                           f_managementAllocator,
+                                           f_managementAllocator,
+                                           m_maxNumberOfChunkMagazines);
+    }
+    generateSizeClassIndex();
+}
+
+void MemoryManager::generateSizeClassIndex()
+{
+    uint32_t index{0u};
+    for (uint32_t sizeClass = 0u; sizeClass < NUMBER_OF_SIZE_CLASSES; ++sizeClass)
+    {
+        const uint64_t lowerBound = (sizeClass > 0u) ? (1ULL << (sizeClass - 1u)) : 0u;
+        while (index < m_memPoolVector.size() && m_memPoolVector[index].getChunkSize() <= lowerBound)
+        {
+            ++index;
+        }
+        m_sizeClassIndex[sizeClass] = static_cast<uint8_t>(index);
+    }
+}
+
+uint32_t MemoryManager::getMemPoolIndexForChunkSize(const uint64_t f_chunkSize) const
+{
+    if (f_chunkSize > std::numeric_limits<uint32_t>::max())
+    {
+        return static_cast<uint32_t>(m_memPoolVector.size());
+    }
+
+    uint32_t index = m_sizeClassIndex[sizeClassOf(static_cast<uint32_t>(f_chunkSize))];
+    while (index < m_memPoolVector.size() && m_memPoolVector[index].getChunkSize() < f_chunkSize)
+    {
+        ++index;
+    }
+    return index;
 }
 
 uint32_t MemoryManager::getNumberOfMemPools() const
@@ -78,26 +164,67 @@ uint32_t MemoryManager::getNumberOfMemPools() const
     return static_cast<uint32_t>(m_memPoolVector.size());
 }
 
+MemPoolFallbackPolicy MemoryManager::getFallbackPolicy() const
+{
+    return m_fallbackPolicy;
+}
+
+ChunkManagementLayout MemoryManager::getChunkManagementLayout() const
+{
+    return m_chunkManagementLayout;
+}
+
 MemPoolInfo MemoryManager::getMemPoolInfo(uint32_t index) const
 {
     if (index >= m_memPoolVector.size())
     {
         return {0, 0, 0, 0};
     }
-    return m_memPoolVector[index].getInfo();
+    MemPoolInfo info = m_memPoolVector[index].getInfo();
+    info.m_maxRequestedPayloadSize = m_maxRequestedPayloadSize[index].load(std::memory_order_relaxed);
+    return info;
 }
 
-uint32_t MemoryManager::getMempoolChunkSizeForPayloadSize(const uint32_t f_size) const
+bool MemoryManager::isAllocationProfileRecorded() const
 {
-    uint32_t adjustedSize = MemoryManager::sizeWithChunkHeaderStruct(f_size);
-    for (auto& memPool : m_memPoolVector)
+    return m_recordAllocationProfile;
+}
+
+uint64_t MemoryManager::getRequestedPayloadSizeCount(const uint32_t f_bucket) const
+{
+    return (f_bucket < ALLOCATION_PROFILE_NUMBER_OF_BUCKETS)
+               ? m_requestedPayloadSizes[f_bucket].load(std::memory_order_relaxed)
+               : 0u;
+}
+
+void MemoryManager::recordRequestedPayloadSize(const uint32_t f_payloadSize, const uint32_t f_numberOfChunks)
+{
+    if (m_recordAllocationProfile)
     {
-        const auto chunkSize = memPool.getChunkSize();
-        if (chunkSize >= adjustedSize)
+        m_requestedPayloadSizes[sizeClassOf(f_payloadSize)].fetch_add(f_numberOfChunks, std::memory_order_relaxed);
+    }
+}
+
+void MemoryManager::recordServedPayloadSize(const MemPool* const f_memPool, const uint32_t f_payloadSize)
+{
+    if (m_recordAllocationProfile)
+    {
+        auto& maxRequestedPayloadSize = m_maxRequestedPayloadSize[f_memPool - &m_memPoolVector.front()];
+        uint32_t currentMax = maxRequestedPayloadSize.load(std::memory_order_relaxed);
+        while (currentMax < f_payloadSize
+               && !maxRequestedPayloadSize.compare_exchange_weak(currentMax, f_payloadSize, std::memory_order_relaxed))
         {
-            return chunkSize;
         }
     }
+}
+
+uint32_t MemoryManager::getMempoolChunkSizeForPayloadSize(const uint32_t f_size) const
+{
+    const uint32_t index = getMemPoolIndexForChunkSize(chunkSizeForPayloadSize(f_size));
+    if (index < m_memPoolVector.size())
+    {
+        return m_memPoolVector[index].getChunkSize() - chunkManagementSizeInChunk(m_chunkManagementLayout);
+    }
 
     return 0;
 }
@@ -110,10 +237,12 @@ uint32_t MemoryManager::sizeWithChunkHeaderStruct(const MaxSize_t f_size)
 uint64_t MemoryManager::requiredChunkMemorySize(const MePooConfig& f_mePooConfig)
 {
     uint64_t memorySize{0};
+    const uint32_t chunkManagementSize = chunkManagementSizeInChunk(f_mePooConfig.m_chunkManagementLayout);
     for (const auto& mempool : f_mePooConfig.m_mempoolConfig)
     {
-        memorySize +=
-            static_cast<uint64_t>(mempool.m_chunkCount) * MemoryManager::sizeWithChunkHeaderStruct(mempool.m_size);
+        memorySize += static_cast<uint64_t>(mempool.m_chunkCount)
+                      * (static_cast<uint64_t>(MemoryManager::sizeWithChunkHeaderStruct(mempool.m_size))
+                         + chunkManagementSize);
     }
     return memorySize;
 }
@@ -122,16 +251,24 @@ uint64_t MemoryManager::requiredManagementMemorySize(const MePooConfig& f_mePooC
 {
     uint64_t memorySize{0u};
     uint32_t sumOfAllChunks{0u};
+    uint32_t maxNumberOfChunkMagazines{0u};
     for (const auto& mempool : f_mePooConfig.m_mempoolConfig)
     {
         sumOfAllChunks += mempool.m_chunkCount;
+        maxNumberOfChunkMagazines = std::max(maxNumberOfChunkMagazines, mempool.m_chunkMagazineCount);
         memorySize += cxx::align(static_cast<uint64_t>(MemPool::freeList_t::requiredMemorySize(mempool.m_chunkCount)),
                                  SHARED_MEMORY_ALIGNMENT);
+        memorySize += MemPool::requiredChunkMagazineMemorySize(mempool.m_chunkMagazineCount);
     }
 
-    memorySize += sumOfAllChunks * sizeof(ChunkManagement);
-    memorySize += cxx::align(static_cast<uint64_t>(MemPool::freeList_t::requiredMemorySize(sumOfAllChunks)),
-                             SHARED_MEMORY_ALIGNMENT);
+    if (f_mePooConfig.m_chunkManagementLayout == ChunkManagementLayout::SEPARATE_POOL)
+    {
+        memorySize += MemPool::requiredChunkMagazineMemorySize(maxNumberOfChunkMagazines);
+
+        memorySize += sumOfAllChunks * sizeof(ChunkManagement);
+        memorySize += cxx::align(static_cast<uint64_t>(MemPool::freeList_t::requiredMemorySize(sumOfAllChunks)),
+                                 SHARED_MEMORY_ALIGNMENT);
+    }
 
     return memorySize;
 }
@@ -145,30 +282,75 @@ void MemoryManager::configureMemoryManager(const MePooConfig& f_mePooConfig,
                                            posix::Allocator* f_managementAllocator,
                                            posix::Allocator* f_payloadAllocator)
 {
+    m_fallbackPolicy = f_mePooConfig.m_fallbackPolicy;
+    m_chunkManagementLayout = f_mePooConfig.m_chunkManagementLayout;
+    m_recordAllocationProfile = f_mePooConfig.m_recordAllocationProfile;
     for (auto entry : f_mePooConfig.m_mempoolConfig)
     {
-        addMemPool(f_managementAllocator, f_payloadAllocator, entry.m_size, entry.m_chunkCount);
+        addMemPool(
+            f_managementAllocator, f_payloadAllocator, entry.m_size, entry.m_chunkCount, entry.m_chunkMagazineCount);
     }
 
     generateChunkManagementPool(f_managementAllocator);
 }
 
-SharedChunk MemoryManager::getChunk(const MaxSize_t f_size)
+void* MemoryManager::getChunkFromMemPool(const uint32_t f_index, ChunkMagazines* const f_magazines)
+{
+    auto& memPool = m_memPoolVector[f_index];
+    return (f_magazines != nullptr) ? f_magazines->m_payload[f_index].getChunk(memPool) : memPool.getChunk();
+}
+
+uint32_t MemoryManager::getLastMemPoolIndexForFallback(const uint32_t f_fittingIndex) const
+{
+    const uint32_t numberOfMemPools = static_cast<uint32_t>(m_memPoolVector.size());
+    switch (m_fallbackPolicy)
+    {
+    case MemPoolFallbackPolicy::STRICT:
+        break;
+    case MemPoolFallbackPolicy::NEXT_LARGER:
+        return std::min(f_fittingIndex + 1u, numberOfMemPools - 1u);
+    case MemPoolFallbackPolicy::ANY_LARGER:
+        return numberOfMemPools - 1u;
+    }
+    return f_fittingIndex;
+}
+
+SharedChunk MemoryManager::constructChunk(void* const f_chunk,
+                                          MemPool* const f_memPool,
+                                          void* const f_chunkManagementMemory,
+                                          const uint32_t f_payloadSize)
+{
+    const uint32_t chunkManagementSize = chunkManagementSizeInChunk(m_chunkManagementLayout);
+    ChunkHeader* chunkHeader = new (static_cast<uint8_t*>(f_chunk) + chunkManagementSize) ChunkHeader();
+    chunkHeader->m_info.m_payloadSize = f_payloadSize;
+    chunkHeader->m_info.m_usedSizeOfChunk = MemoryManager::sizeWithChunkHeaderStruct(f_payloadSize);
+    chunkHeader->m_info.m_totalSizeOfChunk = f_memPool->getChunkSize() - chunkManagementSize;
+
+    if (m_chunkManagementLayout == ChunkManagementLayout::IN_CHUNK)
+    {
+        return SharedChunk(new (f_chunk) ChunkManagement(chunkHeader, f_memPool));
+    }
+    return SharedChunk(new (f_chunkManagementMemory)
+                           ChunkManagement(chunkHeader, f_memPool, &m_chunkManagementPool.front()));
+}
+
+SharedChunk MemoryManager::getChunk(const MaxSize_t f_size, ChunkMagazines* const f_magazines)
 {
     void* chunk{nullptr};
     MemPool* memPoolPointer{nullptr};
     uint32_t adjustedSize = MemoryManager::sizeWithChunkHeaderStruct(f_size);
-    uint32_t totalSizeOfAquiredChunk = 0;
 
-    for (auto& memPool : m_memPoolVector)
+    recordRequestedPayloadSize(f_size, 1u);
+
+    const uint32_t numberOfMemPools = static_cast<uint32_t>(m_memPoolVector.size());
+    const uint32_t fittingIndex = getMemPoolIndexForChunkSize(chunkSizeForPayloadSize(f_size));
+    if (fittingIndex < numberOfMemPools)
     {
-        uint32_t chunkSizeOfMemPool = memPool.getChunkSize();
-        if (chunkSizeOfMemPool >= adjustedSize)
+        const uint32_t lastIndex = getLastMemPoolIndexForFallback(fittingIndex);
+        for (uint32_t index = fittingIndex; chunk == nullptr && index <= lastIndex; ++index)
         {
-            chunk = memPool.getChunk();
-            memPoolPointer = &memPool;
-            totalSizeOfAquiredChunk = chunkSizeOfMemPool;
-            break;
+            chunk = getChunkFromMemPool(index, f_magazines);
+            memPoolPointer = &m_memPoolVector[index];
         }
     }
 
@@ -188,17 +370,98 @@ SharedChunk MemoryManager::getChunk(const MaxSize_t f_size)
         printMemPoolVector();
         return SharedChunk(nullptr);
     }
+
+    recordServedPayloadSize(memPoolPointer, f_size);
+    if (m_chunkManagementLayout == ChunkManagementLayout::IN_CHUNK)
+    {
+        return constructChunk(chunk, memPoolPointer, nullptr, f_size);
+    }
     else
     {
-        new (chunk) ChunkHeader();
-        static_cast<ChunkHeader*>(chunk)->m_info.m_payloadSize = f_size;
-        static_cast<ChunkHeader*>(chunk)->m_info.m_usedSizeOfChunk = adjustedSize;
-        static_cast<ChunkHeader*>(chunk)->m_info.m_totalSizeOfChunk = totalSizeOfAquiredChunk;
-        ChunkManagement* chunkManagement = static_cast<ChunkManagement*>(m_chunkManagementPool.front().getChunk());
-        new (chunkManagement)
-            ChunkManagement(static_cast<ChunkHeader*>(chunk), memPoolPointer, &m_chunkManagementPool.front());
-        return SharedChunk(chunkManagement);
+        auto& chunkManagementPool = m_chunkManagementPool.front();
+        void* chunkManagementMemory = (f_magazines != nullptr)
+                                          ? f_magazines->m_chunkManagement.getChunk(chunkManagementPool)
+                                          : chunkManagementPool.getChunk();
+        return constructChunk(chunk, memPoolPointer, chunkManagementMemory, f_size);
+    }
+}
+
+uint32_t MemoryManager::getChunks(const MaxSize_t f_size,
+                                  SharedChunk* const f_chunks,
+                                  const uint32_t f_numberOfChunks,
+                                  ChunkMagazines* const f_magazines)
+{
+    recordRequestedPayloadSize(f_size, f_numberOfChunks);
+
+    const uint32_t numberOfMemPools = static_cast<uint32_t>(m_memPoolVector.size());
+    const uint32_t fittingIndex = getMemPoolIndexForChunkSize(chunkSizeForPayloadSize(f_size));
+    if (fittingIndex >= numberOfMemPools)
+    {
+        std::cerr << "The following mempools are available:" << std::endl;
+        printMemPoolVector();
+        std::cerr << "\nCould not find a fitting mempool for a chunk of size "
+                  << MemoryManager::sizeWithChunkHeaderStruct(f_size) << std::endl;
+
+        errorHandler(Error::kMEPOO__MEMPOOL_GETCHUNK_CHUNK_IS_TOO_LARGE);
+        return 0u;
+    }
+    const uint32_t lastIndex = getLastMemPoolIndexForFallback(fittingIndex);
+
+    // the chunks are acquired in blocks which fit on the stack, a block takes one batched pop per mempool
+    uint32_t numberOfChunks{0u};
+    while (numberOfChunks < f_numberOfChunks)
+    {
+        const uint32_t blockSize = std::min(f_numberOfChunks - numberOfChunks, CHUNK_MAGAZINE_CAPACITY);
+        void* chunks[CHUNK_MAGAZINE_CAPACITY];
+        MemPool* memPools[CHUNK_MAGAZINE_CAPACITY];
+
+        uint32_t numberOfBlockChunks{0u};
+        for (uint32_t index = fittingIndex; numberOfBlockChunks < blockSize && index <= lastIndex; ++index)
+        {
+            auto& memPool = m_memPoolVector[index];
+            const uint32_t numberOfAcquiredChunks =
+                (f_magazines != nullptr)
+                    ? f_magazines->m_payload[index].getChunks(
+                        memPool, &chunks[numberOfBlockChunks], blockSize - numberOfBlockChunks)
+                    : memPool.getChunks(&chunks[numberOfBlockChunks], blockSize - numberOfBlockChunks);
+            for (uint32_t i = 0u; i < numberOfAcquiredChunks; ++i)
+            {
+                memPools[numberOfBlockChunks++] = &memPool;
+            }
+        }
+
+        void* chunkManagementMemory[CHUNK_MAGAZINE_CAPACITY]{nullptr};
+        if (m_chunkManagementLayout == ChunkManagementLayout::SEPARATE_POOL && numberOfBlockChunks > 0u)
+        {
+            auto& chunkManagementPool = m_chunkManagementPool.front();
+            const uint32_t numberOfChunkManagements =
+                (f_magazines != nullptr)
+                    ? f_magazines->m_chunkManagement.getChunks(
+                        chunkManagementPool, chunkManagementMemory, numberOfBlockChunks)
+                    : chunkManagementPool.getChunks(chunkManagementMemory, numberOfBlockChunks);
+
+            // chunks without a ChunkManagement are returned right away
+            for (uint32_t i = numberOfChunkManagements; i < numberOfBlockChunks; ++i)
+            {
+                memPools[i]->freeChunk(chunks[i]);
+            }
+            numberOfBlockChunks = numberOfChunkManagements;
+        }
+
+        for (uint32_t i = 0u; i < numberOfBlockChunks; ++i)
+        {
+            recordServedPayloadSize(memPools[i], f_size);
+            f_chunks[numberOfChunks++] = constructChunk(chunks[i], memPools[i], chunkManagementMemory[i], f_size);
+        }
+
+        if (numberOfBlockChunks < blockSize)
+        {
+            break;
+        }
     }
+
+    return numberOfChunks;
 }
+
 } // namespace mepoo
 } // namespace iox
@@ -71,10 +71,12 @@ MePooConfig& MePooConfig::optimize() noexcept
             }
             newEntry.m_size = entry.m_size;
             newEntry.m_chunkCount = entry.m_chunkCount;
+            newEntry.m_chunkMagazineCount = entry.m_chunkMagazineCount;
         }
         else
         {
             newEntry.m_chunkCount += entry.m_chunkCount;
+            newEntry.m_chunkMagazineCount = std::max(newEntry.m_chunkMagazineCount, entry.m_chunkMagazineCount);
         }
     }
 
@@ -62,8 +62,16 @@ void SharedChunk::decrementReferenceCounter()
 
 void SharedChunk::freeChunk()
 {
-    m_chunkManagement->m_mempool->freeChunk(m_chunkManagement->m_chunkHeader);
-    m_chunkManagement->m_chunkManagementPool->freeChunk(m_chunkManagement);
+    if (m_chunkManagement->m_chunkManagementPool == nullptr)
+    {
+        // the ChunkManagement is located at the beginning of the chunk, one free list access releases both
+        m_chunkManagement->m_mempool->freeChunk(m_chunkManagement);
+    }
+    else
+    {
+        m_chunkManagement->m_mempool->freeChunk(m_chunkManagement->m_chunkHeader);
+        m_chunkManagement->m_chunkManagementPool->freeChunk(m_chunkManagement);
+    }
 }
 
 SharedChunk& SharedChunk::operator=(const SharedChunk& rhs)
@@ -41,6 +41,13 @@ PublisherPortUser::tryAllocateChunk(const uint32_t payloadSize) noexcept
     return m_chunkSender.tryAllocate(payloadSize, getUniqueID());
 }
 
+cxx::expected<AllocationError> PublisherPortUser::tryAllocateChunks(const uint32_t payloadSize,
+                                                                    mepoo::ChunkHeader** const chunkHeaders,
+                                                                    const uint32_t numberOfChunks) noexcept
+{
+    return m_chunkSender.tryAllocateN(payloadSize, getUniqueID(), chunkHeaders, numberOfChunks);
+}
+
 void PublisherPortUser::freeChunk(mepoo::ChunkHeader* const chunkHeader) noexcept
 {
     m_chunkSender.release(chunkHeader);
@@ -64,11 +71,35 @@ void PublisherPortUser::sendChunk(mepoo::ChunkHeader* const chunkHeader) noexcep
     }
 }
 
+void PublisherPortUser::sendChunks(mepoo::ChunkHeader* const* const chunkHeaders,
+                                   const uint32_t numberOfChunks) noexcept
+{
+    const auto offerRequested = getMembers()->m_offeringRequested.load(std::memory_order_relaxed);
+
+    if (offerRequested)
+    {
+        m_chunkSender.sendN(chunkHeaders, numberOfChunks);
+    }
+    else
+    {
+        // see sendChunk why the chunks are put in the history if the publisher port is not offered
+        for (uint32_t i = 0u; i < numberOfChunks; ++i)
+        {
+            m_chunkSender.pushToHistory(chunkHeaders[i]);
+        }
+    }
+}
+
 cxx::optional<const mepoo::ChunkHeader*> PublisherPortUser::tryGetPreviousChunk() const noexcept
 {
     return m_chunkSender.tryGetPreviousChunk();
 }
 
+void PublisherPortUser::setChunkMagazineBatchSize(const uint32_t batchSize) noexcept
+{
+    m_chunkSender.setChunkMagazineBatchSize(batchSize);
+}
+
 void PublisherPortUser::offer() noexcept
 {
     if (!getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
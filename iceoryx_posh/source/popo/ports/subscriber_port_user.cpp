@@ -89,6 +89,12 @@ void SubscriberPortUser::releaseChunk(const mepoo::ChunkHeader* const chunkHeade
     m_chunkReceiver.release(chunkHeader);
 }
 
+void SubscriberPortUser::releaseChunks(const mepoo::ChunkHeader* const* const chunkHeaders,
+                                       const uint32_t numberOfChunks) noexcept
+{
+    m_chunkReceiver.releaseN(chunkHeaders, numberOfChunks);
+}
+
 void SubscriberPortUser::releaseQueuedChunks() noexcept
 {
     m_chunkReceiver.clear();
@@ -142,6 +142,9 @@ RouDiConfig_t RouDiApp::generateConfigFromMePooConfig(const mepoo::MePooConfig*
         {
             defaultConfig.m_sharedMemorySegments.front().m_mempoolConfig.m_mempoolConfig.push_back({entry});
         }
+        defaultConfig.m_sharedMemorySegments.front().m_mempoolConfig.m_fallbackPolicy = mePooConfig->m_fallbackPolicy;
+        defaultConfig.m_sharedMemorySegments.front().m_mempoolConfig.m_chunkManagementLayout =
+            mePooConfig->m_chunkManagementLayout;
     }
 
     return defaultConfig;
@@ -23,7 +23,11 @@ namespace roudi
 DefaultRouDiMemory::DefaultRouDiMemory(const RouDiConfig_t& roudiConfig) noexcept
     : m_introspectionMemPoolBlock(introspectionMemPoolConfig())
     , m_segmentManagerBlock(roudiConfig)
-    , m_managementShm(SHM_NAME, posix::AccessMode::readWrite, posix::OwnerShip::mine)
+    , m_managementShm(SHM_NAME,
+                      posix::AccessMode::readWrite,
+                      posix::OwnerShip::mine,
+                      posix::PageType::normal,
+                      roudiConfig.m_managementPageFaultPolicy)
 
 {
     m_managementShm.addMemoryBlock(&m_introspectionMemPoolBlock);
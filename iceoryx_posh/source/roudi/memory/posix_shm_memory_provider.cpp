@@ -40,10 +40,14 @@ void sigbusHandler(int32_t) noexcept
 
 PosixShmMemoryProvider::PosixShmMemoryProvider(const ShmNameString& shmName,
                                                const posix::AccessMode accessMode,
-                                               const posix::OwnerShip ownership) noexcept
+                                               const posix::OwnerShip ownership,
+                                               const posix::PageType pageType,
+                                               const posix::PageFaultPolicy pageFaultPolicy) noexcept
     : m_shmName(shmName)
     , m_accessMode(accessMode)
     , m_ownership(ownership)
+    , m_pageType(pageType)
+    , m_pageFaultPolicy(pageFaultPolicy)
 {
 }
 
@@ -82,7 +86,14 @@ cxx::expected<void*, MemoryProviderError> PosixShmMemoryProvider::createMemory(c
     }
 
     // create and map a shared memory region
-    m_shmObject = posix::SharedMemoryObject::create(m_shmName.c_str(), size, m_accessMode, m_ownership, nullptr);
+    m_shmObject = posix::SharedMemoryObject::create(m_shmName.c_str(),
+                                                    size,
+                                                    m_accessMode,
+                                                    m_ownership,
+                                                    nullptr,
+                                                    S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH,
+                                                    m_pageType,
+                                                    m_pageFaultPolicy);
 
     // unregister signal handler
     if (cxx::makeSmartC(sigaction, cxx::ReturnMode::PRE_DEFINED_SUCCESS_CODE, {0}, {}, SIGBUS, &oldAct, nullptr)
@@ -18,6 +18,8 @@
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iceoryx_posh/roudi/memory/memory_provider.hpp"
 
+#include <chrono>
+
 namespace iox
 {
 namespace roudi
@@ -43,6 +45,9 @@ cxx::expected<RouDiMemoryManagerError> RouDiMemoryManager::createAndAnnounceMemo
         return cxx::error<RouDiMemoryManagerError>(RouDiMemoryManagerError::NO_MEMORY_PROVIDER_PRESENT);
     }
 
+    // the creation includes touching and optionally locking all pages, which can take a while for large segments
+    auto start = std::chrono::steady_clock::now();
+
     for (auto memoryProvider : m_memoryProvider)
     {
         auto result = memoryProvider->create();
@@ -59,6 +64,9 @@ cxx::expected<RouDiMemoryManagerError> RouDiMemoryManager::createAndAnnounceMemo
         memoryProvider->announceMemoryAvailable();
     }
 
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    LogInfo() << "Creating the shared memory took " << static_cast<uint64_t>(duration.count()) << " ms";
+
     return cxx::success<>();
 }
 
@@ -0,0 +1,114 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/roudi/mempool_layout_tuner.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_utils/cxx/helplets.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace iox
+{
+namespace roudi
+{
+mepoo::MePooConfig suggestMePooConfig(const MemPoolIntrospectionInfo& f_recording,
+                                      const uint32_t f_headroomPercent) noexcept
+{
+    mepoo::MePooConfig suggestion;
+    for (const auto& info : f_recording.m_mempoolInfo)
+    {
+        const uint32_t peakUsedChunks = info.m_numChunks - std::min(info.m_minFreeChunks, info.m_numChunks);
+        if (peakUsedChunks == 0u)
+        {
+            continue;
+        }
+
+        uint32_t payloadSize = info.m_payloadSize;
+        if (f_recording.m_isAllocationProfileRecorded && info.m_maxRequestedPayloadSize > 0u)
+        {
+            payloadSize = static_cast<uint32_t>(
+                cxx::align(static_cast<uint64_t>(info.m_maxRequestedPayloadSize), mepoo::MemPool::MEMORY_ALIGNMENT));
+        }
+
+        const uint64_t headroom =
+            (static_cast<uint64_t>(peakUsedChunks) * f_headroomPercent + 99u) / 100u; // round up
+        const uint32_t chunkCount = static_cast<uint32_t>(
+            std::min(peakUsedChunks + headroom, static_cast<uint64_t>(std::numeric_limits<uint32_t>::max())));
+
+        // with a fallback policy a mempool also serves smaller payloads, its chunks are merged into the previous
+        // mempool if they do not need to be larger
+        if (!suggestion.m_mempoolConfig.empty() && payloadSize <= suggestion.m_mempoolConfig.back().m_size)
+        {
+            auto& previous = suggestion.m_mempoolConfig.back();
+            previous.m_chunkCount = static_cast<uint32_t>(
+                std::min(static_cast<uint64_t>(previous.m_chunkCount) + chunkCount,
+                         static_cast<uint64_t>(std::numeric_limits<uint32_t>::max())));
+        }
+        else
+        {
+            suggestion.addMemPool({payloadSize, chunkCount});
+        }
+    }
+    return suggestion;
+}
+
+void writeMemPoolLayout(std::ostream& f_stream,
+                        const MemPoolIntrospectionInfo& f_recording,
+                        const mepoo::MePooConfig& f_suggestion) noexcept
+{
+    uint64_t recordedChunkMemory{0u};
+    for (const auto& info : f_recording.m_mempoolInfo)
+    {
+        recordedChunkMemory += static_cast<uint64_t>(info.m_numChunks) * info.m_chunkSize;
+        if (info.m_numChunks > 0u && info.m_minFreeChunks == 0u)
+        {
+            f_stream << "# the mempool with payload size " << info.m_payloadSize
+                     << " was exhausted during the recording, its peak usage is a lower bound\n";
+        }
+    }
+
+    if (f_recording.m_isAllocationProfileRecorded)
+    {
+        f_stream << "# requested payload sizes:\n";
+        for (uint32_t bucket = 0u; bucket < mepoo::ALLOCATION_PROFILE_NUMBER_OF_BUCKETS; ++bucket)
+        {
+            if (f_recording.m_requestedPayloadSizes[bucket] > 0u)
+            {
+                f_stream << "#   <= " << (1ULL << bucket) << ": " << f_recording.m_requestedPayloadSizes[bucket]
+                         << "\n";
+            }
+        }
+    }
+    else
+    {
+        f_stream << "# the allocation profile was not recorded, the payload sizes are taken over as they are\n";
+    }
+
+    f_stream << "# chunk memory: " << recordedChunkMemory << " bytes recorded, "
+             << mepoo::MemoryManager::requiredChunkMemorySize(f_suggestion) << " bytes suggested\n";
+    f_stream << "[[segment]]\n";
+    f_stream << "reader = \"" << f_recording.m_readerGroupName << "\"\n";
+    f_stream << "writer = \"" << f_recording.m_writerGroupName << "\"\n";
+    for (const auto& entry : f_suggestion.m_mempoolConfig)
+    {
+        f_stream << "\n[[segment.mempool]]\n";
+        f_stream << "size = " << entry.m_size << "\n";
+        f_stream << "count = " << entry.m_chunkCount << "\n";
+    }
+}
+
+} // namespace roudi
+} // namespace iox
@@ -28,6 +28,23 @@ namespace iox
 {
 namespace config
 {
+namespace
+{
+/// @brief reads the optional "prefault" and "mlock" entries of a table, "mlock" implies "prefault"
+posix::PageFaultPolicy parsePageFaultPolicy(const cpptoml::table& table)
+{
+    if (table.get_as<bool>("mlock").value_or(false))
+    {
+        return posix::PageFaultPolicy::lock;
+    }
+    if (table.get_as<bool>("prefault").value_or(false))
+    {
+        return posix::PageFaultPolicy::prefault;
+    }
+    return posix::PageFaultPolicy::onDemand;
+}
+} // namespace
+
 TomlRouDiConfigFileProvider::TomlRouDiConfigFileProvider(CmdLineParserConfigFileOption& cmdLineParser)
 {
     /// don't print additional output if not running
@@ -93,11 +110,53 @@ iox::cxx::expected<iox::RouDiConfig_t, iox::roudi::RouDiConfigFileParseError> To
     }
 
     iox::RouDiConfig_t parsedConfig;
+    parsedConfig.m_managementPageFaultPolicy = parsePageFaultPolicy(*general);
     for (auto segment : *segments)
     {
         auto writer = segment->get_as<std::string>("writer").value_or(groupOfCurrentProcess);
         auto reader = segment->get_as<std::string>("reader").value_or(groupOfCurrentProcess);
+        auto pageType = segment->get_as<bool>("hugepages").value_or(false) ? iox::posix::PageType::huge
+                                                                           : iox::posix::PageType::normal;
+        auto pageFaultPolicy = parsePageFaultPolicy(*segment);
+        auto numaNode = segment->get_as<uint32_t>("numa-node").value_or(iox::mepoo::MemoryInfo::ANY_NUMA_NODE);
+        auto fallbackPolicy = segment->get_as<std::string>("fallback").value_or("strict");
         iox::mepoo::MePooConfig mempoolConfig;
+        if (fallbackPolicy == "strict")
+        {
+            mempoolConfig.m_fallbackPolicy = iox::mepoo::MemPoolFallbackPolicy::STRICT;
+        }
+        else if (fallbackPolicy == "next-larger")
+        {
+            mempoolConfig.m_fallbackPolicy = iox::mepoo::MemPoolFallbackPolicy::NEXT_LARGER;
+        }
+        else if (fallbackPolicy == "any-larger")
+        {
+            mempoolConfig.m_fallbackPolicy = iox::mepoo::MemPoolFallbackPolicy::ANY_LARGER;
+        }
+        else
+        {
+            return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+                iox::roudi::RouDiConfigFileParseError::INVALID_MEMPOOL_FALLBACK_POLICY);
+        }
+
+        auto chunkManagementLayout = segment->get_as<std::string>("chunk-management").value_or("separate-pool");
+        if (chunkManagementLayout == "separate-pool")
+        {
+            mempoolConfig.m_chunkManagementLayout = iox::mepoo::ChunkManagementLayout::SEPARATE_POOL;
+        }
+        else if (chunkManagementLayout == "in-chunk" && reader == writer)
+        {
+            // the reference counter is in the payload segment and readers must be able to update it
+            mempoolConfig.m_chunkManagementLayout = iox::mepoo::ChunkManagementLayout::IN_CHUNK;
+        }
+        else
+        {
+            return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+                iox::roudi::RouDiConfigFileParseError::INVALID_CHUNK_MANAGEMENT_LAYOUT);
+        }
+
+        mempoolConfig.m_recordAllocationProfile = segment->get_as<bool>("record-allocation-profile").value_or(false);
+
         auto mempools = segment->get_table_array("mempool");
         if (!mempools)
         {
@@ -115,6 +174,7 @@ iox::cxx::expected<iox::RouDiConfig_t, iox::roudi::RouDiConfigFileParseError> To
         {
             auto chunkSize = mempool->get_as<uint32_t>("size");
             auto chunkCount = mempool->get_as<uint32_t>("count");
+            auto chunkMagazineCount = mempool->get_as<uint32_t>("magazines").value_or(0u);
             if (!chunkSize)
             {
                 return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
@@ -125,12 +185,21 @@ iox::cxx::expected<iox::RouDiConfig_t, iox::roudi::RouDiConfigFileParseError> To
                 return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
                     iox::roudi::RouDiConfigFileParseError::MEMPOOL_WITHOUT_CHUNK_COUNT);
             }
-            mempoolConfig.addMemPool({*chunkSize, *chunkCount});
+            if (chunkMagazineCount > iox::MAX_CHUNK_MAGAZINES_PER_MEMPOOL)
+            {
+                return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+                    iox::roudi::RouDiConfigFileParseError::MAX_NUMBER_OF_CHUNK_MAGAZINES_PER_MEMPOOL_EXCEEDED);
+            }
+            mempoolConfig.addMemPool({*chunkSize, *chunkCount, chunkMagazineCount});
         }
         parsedConfig.m_sharedMemorySegments.push_back(
             {iox::posix::PosixGroup::string_t(iox::cxx::TruncateToCapacity, reader),
              iox::posix::PosixGroup::string_t(iox::cxx::TruncateToCapacity, writer),
-             mempoolConfig});
+             mempoolConfig,
+             iox::mepoo::MemoryInfo(
+                 iox::mepoo::MemoryInfo::DEFAULT_DEVICE_ID, iox::mepoo::MemoryInfo::DEFAULT_MEMORY_TYPE, numaNode),
+             pageType,
+             pageFaultPolicy});
     }
 
     return iox::cxx::success<iox::RouDiConfig_t>(parsedConfig);
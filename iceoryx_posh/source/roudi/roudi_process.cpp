@@ -37,11 +37,13 @@ namespace roudi
 {
 RouDiProcess::RouDiProcess(const ProcessName_t& name,
                            int32_t pid,
+                           posix::PosixUser user,
                            mepoo::MemoryManager* payloadMemoryManager,
                            bool isMonitored,
                            const uint64_t payloadSegmentId,
                            const uint64_t sessionId) noexcept
     : m_pid(pid)
+    , m_user(user)
     , m_mq(name)
     , m_timestamp(mepoo::BaseClock::now())
     , m_payloadMemoryManager(payloadMemoryManager)
@@ -81,6 +83,11 @@ mepoo::TimePointNs RouDiProcess::getTimestamp() noexcept
     return m_timestamp;
 }
 
+posix::PosixUser RouDiProcess::getUser() const noexcept
+{
+    return m_user;
+}
+
 mepoo::MemoryManager* RouDiProcess::getPayloadMemoryManager() const noexcept
 {
     return m_payloadMemoryManager;
@@ -316,6 +323,7 @@ bool ProcessManager::registerProcess(const ProcessName_t& name,
         // process does not exist in list and can be added
         return addProcess(name,
                           pid,
+                          user,
                           segmentInfo.m_memoryManager,
                           isMonitored,
                           transmissionTimestamp,
@@ -352,6 +360,7 @@ bool ProcessManager::registerProcess(const ProcessName_t& name,
         // try registration again, should succeed since removal was successful
         return addProcess(name,
                           pid,
+                          user,
                           segmentInfo.m_memoryManager,
                           isMonitored,
                           transmissionTimestamp,
@@ -365,6 +374,7 @@ bool ProcessManager::registerProcess(const ProcessName_t& name,
 
 bool ProcessManager::addProcess(const ProcessName_t& name,
                                 int32_t pid,
+                                posix::PosixUser user,
                                 mepoo::MemoryManager* payloadMemoryManager,
                                 bool isMonitored,
                                 int64_t transmissionTimestamp,
@@ -389,7 +399,7 @@ bool ProcessManager::addProcess(const ProcessName_t& name,
         return false;
     }
 
-    m_processList.emplace_back(name, pid, payloadMemoryManager, isMonitored, payloadSegmentId, sessionId);
+    m_processList.emplace_back(name, pid, user, payloadMemoryManager, isMonitored, payloadSegmentId, sessionId);
 
     // send REG_ACK and BaseAddrString
     runtime::MqMessage sendBuffer;
@@ -410,6 +420,18 @@ bool ProcessManager::addProcess(const ProcessName_t& name,
     return true;
 }
 
+mepoo::MemoryManager* ProcessManager::getPayloadMemoryManager(const RouDiProcess& process,
+                                                              const PortConfigInfo& portConfigInfo) const noexcept
+{
+    auto numaNode = portConfigInfo.memoryInfo.numaNode;
+    if (numaNode == mepoo::MemoryInfo::ANY_NUMA_NODE)
+    {
+        return process.getPayloadMemoryManager();
+    }
+
+    return m_segmentManager->getSegmentInformationForUser(process.getUser(), numaNode).m_memoryManager;
+}
+
 bool ProcessManager::removeProcess(const ProcessName_t& name) noexcept
 {
     std::lock_guard<std::mutex> lockGuard(m_mutex);
@@ -646,7 +668,7 @@ void ProcessManager::addSenderForProcess(const ProcessName_t& name,
     {
         // create a SenderPort
         auto maybeSender = m_portManager.acquireSenderPortData(
-            service, name, process->getPayloadMemoryManager(), runnable, portConfigInfo);
+            service, name, getPayloadMemoryManager(*process, portConfigInfo), runnable, portConfigInfo);
 
         if (!maybeSender.has_error())
         {
@@ -732,8 +754,12 @@ void ProcessManager::addPublisherForProcess(const ProcessName_t& name,
     if (nullptr != process)
     {
         // create a PublisherPort
-        auto maybePublisher = m_portManager.acquirePublisherPortData(
-            service, historyCapacity, name, process->getPayloadMemoryManager(), runnable, portConfigInfo);
+        auto maybePublisher = m_portManager.acquirePublisherPortData(service,
+                                                                     historyCapacity,
+                                                                     name,
+                                                                     getPayloadMemoryManager(*process, portConfigInfo),
+                                                                     runnable,
+                                                                     portConfigInfo);
 
         if (!maybePublisher.has_error())
         {
@@ -18,20 +18,25 @@ namespace iox
 {
 namespace runtime
 {
-PortConfigInfo::PortConfigInfo(uint32_t portType, uint32_t deviceId, uint32_t memoryType) noexcept
+PortConfigInfo::PortConfigInfo(uint32_t portType, uint32_t deviceId, uint32_t memoryType, uint32_t numaNode) noexcept
     : portType(portType)
-    , memoryInfo(deviceId, memoryType)
+    , memoryInfo(deviceId, memoryType, numaNode)
 {
 }
 
 PortConfigInfo::PortConfigInfo(const cxx::Serialization& serialization)
 {
     serialization.extract(portType, memoryInfo.deviceId, memoryInfo.memoryType);
+    // the NUMA node was appended to the serialization, applications which do not send it get the default
+    if (!serialization.getNth(3u, memoryInfo.numaNode))
+    {
+        memoryInfo.numaNode = mepoo::MemoryInfo::ANY_NUMA_NODE;
+    }
 }
 
 PortConfigInfo::operator cxx::Serialization() const noexcept
 {
-    return cxx::Serialization::create(portType, memoryInfo.deviceId, memoryInfo.memoryType);
+    return cxx::Serialization::create(portType, memoryInfo.deviceId, memoryInfo.memoryType, memoryInfo.numaNode);
 }
 } // namespace runtime
 } // namespace iox
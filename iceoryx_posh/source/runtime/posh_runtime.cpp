@@ -20,6 +20,7 @@
 #include "iceoryx_posh/runtime/port_config_info.hpp"
 #include "iceoryx_posh/runtime/runnable.hpp"
 #include "iceoryx_utils/cxx/convert.hpp"
+#include "iceoryx_utils/internal/posix_wrapper/system_configuration.hpp"
 #include "iceoryx_utils/internal/relocatable_pointer/relative_ptr.hpp"
 #include "iceoryx_utils/posix_wrapper/timer.hpp"
 
@@ -29,6 +30,22 @@ namespace iox
 {
 namespace runtime
 {
+namespace
+{
+/// @brief replaces MemoryInfo::LOCAL_NUMA_NODE with the NUMA node of the calling thread, RouDi then prefers the
+/// payload segment on this node for the port
+PortConfigInfo resolveNumaNode(const PortConfigInfo& portConfigInfo) noexcept
+{
+    PortConfigInfo resolvedPortConfigInfo{portConfigInfo};
+    if (portConfigInfo.memoryInfo.numaNode == mepoo::MemoryInfo::LOCAL_NUMA_NODE)
+    {
+        resolvedPortConfigInfo.memoryInfo.numaNode =
+            posix::numaNodeOfCurrentThread().value_or(mepoo::MemoryInfo::ANY_NUMA_NODE);
+    }
+    return resolvedPortConfigInfo;
+}
+} // namespace
+
 std::function<PoshRuntime&(const ProcessName_t& name)> PoshRuntime::s_runtimeFactory =
     PoshRuntime::defaultRuntimeFactory;
 
@@ -51,13 +68,25 @@ ProcessName_t& PoshRuntime::defaultRuntimeInstanceName() noexcept
     return defaultInstanceName;
 }
 
+posix::PageFaultPolicy& PoshRuntime::pageFaultPolicy() noexcept
+{
+    static posix::PageFaultPolicy policy{posix::PageFaultPolicy::onDemand};
+    return policy;
+}
+
+void PoshRuntime::setPageFaultPolicy(const posix::PageFaultPolicy policy) noexcept
+{
+    pageFaultPolicy() = policy;
+}
+
 PoshRuntime::PoshRuntime(const ProcessName_t& name, const bool doMapSharedMemoryIntoThread) noexcept
     : m_appName(verifyInstanceName(name))
     , m_MqInterface(MQ_ROUDI_NAME, name, PROCESS_WAITING_FOR_ROUDI_TIMEOUT)
     , m_ShmInterface(doMapSharedMemoryIntoThread,
                      m_MqInterface.getShmTopicSize(),
                      m_MqInterface.getSegmentManagerAddr(),
-                     m_MqInterface.getSegmentId())
+                     m_MqInterface.getSegmentId(),
+                     pageFaultPolicy())
     , m_applicationPort(getMiddlewareApplication())
 {
     m_keepAliveTimer.start(posix::Timer::RunMode::PERIODIC, posix::Timer::CatchUpPolicy::IMMEDIATE);
@@ -131,7 +160,7 @@ SenderPortType::MemberType_t* PoshRuntime::getMiddlewareSender(const capro::Serv
     MqMessage sendBuffer;
     sendBuffer << mqMessageTypeToString(MqMessageType::CREATE_SENDER) << m_appName
                << static_cast<cxx::Serialization>(service).toString() << runnableName
-               << static_cast<cxx::Serialization>(portConfigInfo).toString();
+               << static_cast<cxx::Serialization>(resolveNumaNode(portConfigInfo)).toString();
 
     auto requestedSenderPort = requestSenderFromRoudi(sendBuffer);
     if (requestedSenderPort.has_error())
@@ -258,7 +287,7 @@ PublisherPortUserType::MemberType_t* PoshRuntime::getMiddlewarePublisher(const c
     MqMessage sendBuffer;
     sendBuffer << mqMessageTypeToString(MqMessageType::CREATE_PUBLISHER) << m_appName
                << static_cast<cxx::Serialization>(service).toString() << std::to_string(historyCapacity) << runnableName
-               << static_cast<cxx::Serialization>(portConfigInfo).toString();
+               << static_cast<cxx::Serialization>(resolveNumaNode(portConfigInfo)).toString();
 
     auto maybePublisher = requestPublisherFromRoudi(sendBuffer);
     if (maybePublisher.has_error())
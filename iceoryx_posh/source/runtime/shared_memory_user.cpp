@@ -20,6 +20,8 @@
 #include "iceoryx_utils/internal/relocatable_pointer/relative_ptr.hpp"
 #include "iceoryx_utils/posix_wrapper/posix_access_rights.hpp"
 
+#include <algorithm>
+
 namespace iox
 {
 namespace runtime
@@ -27,7 +29,8 @@ namespace runtime
 SharedMemoryUser::SharedMemoryUser(const bool doMapSharedMemoryIntoThread,
                                    const size_t topicSize,
                                    std::string segmentManagerAddr,
-                                   const uint64_t segmentId)
+                                   const uint64_t segmentId,
+                                   const posix::PageFaultPolicy pageFaultPolicy)
 {
     if (doMapSharedMemoryIntoThread)
     {
@@ -35,8 +38,14 @@ SharedMemoryUser::SharedMemoryUser(const bool doMapSharedMemoryIntoThread,
         constexpr void* BASE_ADDRESS_HINT{nullptr};
 
         // create and map the already existing shared memory region
-        m_shmObject = posix::SharedMemoryObject::create(
-            SHM_NAME, topicSize, posix::AccessMode::readWrite, posix::OwnerShip::openExisting, BASE_ADDRESS_HINT);
+        m_shmObject = posix::SharedMemoryObject::create(SHM_NAME,
+                                                        topicSize,
+                                                        posix::AccessMode::readWrite,
+                                                        posix::OwnerShip::openExisting,
+                                                        BASE_ADDRESS_HINT,
+                                                        S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH,
+                                                        posix::PageType::normal,
+                                                        pageFaultPolicy);
 
         if (!m_shmObject.has_value())
         {
@@ -62,7 +71,11 @@ SharedMemoryUser::SharedMemoryUser(const bool doMapSharedMemoryIntoThread,
                                                                segment.m_size,
                                                                accessMode,
                                                                posix::OwnerShip::openExisting,
-                                                               BASE_ADDRESS_HINT);
+                                                               BASE_ADDRESS_HINT,
+                                                               S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH,
+                                                               segment.m_pageType,
+                                                               // the policies are ordered by their strength
+                                                               std::max(segment.m_pageFaultPolicy, pageFaultPolicy));
             if (shmObject.has_value())
             {
                 if (static_cast<uint32_t>(m_payloadShmObjects.size()) >= MAX_SHM_SEGMENTS)
@@ -24,7 +24,21 @@ class MePooMemoryManager_MOCK
     {
         return iox::MAX_NUMBER_OF_MEMPOOLS;
     }
+    iox::mepoo::ChunkManagementLayout getChunkManagementLayout() const
+    {
+        return chunkManagementLayout;
+    }
     MOCK_CONST_METHOD1(getMemPoolInfo, iox::mepoo::MemPoolInfo(uint32_t));
+    bool isAllocationProfileRecorded() const
+    {
+        return false;
+    }
+    uint64_t getRequestedPayloadSizeCount(const uint32_t) const
+    {
+        return 0u;
+    }
+
+    iox::mepoo::ChunkManagementLayout chunkManagementLayout{iox::mepoo::ChunkManagementLayout::SEPARATE_POOL};
 };
 
 #endif // IOX_POSH_MOCKS_MEPOO_MEMORY_MANAGER_MOCK_HPP
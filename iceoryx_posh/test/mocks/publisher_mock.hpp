@@ -35,11 +35,17 @@ class MockPublisherPortUser
     MOCK_CONST_METHOD0(getServiceDescription, iox::capro::ServiceDescription());
     MOCK_METHOD1(tryAllocateChunk,
                  iox::cxx::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError>(const uint32_t));
+    MOCK_METHOD3(tryAllocateChunks,
+                 iox::cxx::expected<iox::popo::AllocationError>(const uint32_t,
+                                                                iox::mepoo::ChunkHeader** const,
+                                                                const uint32_t));
     MOCK_METHOD1(freeChunk, void(iox::mepoo::ChunkHeader* const));
     MOCK_METHOD1(sendChunk, void(iox::mepoo::ChunkHeader* const));
+    MOCK_METHOD2(sendChunks, void(iox::mepoo::ChunkHeader* const* const, const uint32_t));
     MOCK_METHOD0(tryGetPreviousChunk, iox::cxx::optional<iox::mepoo::ChunkHeader*>());
     MOCK_METHOD0(offer, void());
     MOCK_METHOD0(stopOffer, void());
+    MOCK_METHOD1(setChunkMagazineBatchSize, void(const uint32_t));
     MOCK_CONST_METHOD0(isOffered, bool());
     MOCK_CONST_METHOD0(hasSubscribers, bool());
     MOCK_METHOD0(destroy, void());
@@ -49,16 +55,21 @@ template <typename T>
 class MockBasePublisher : public iox::popo::PublisherInterface<T>
 {
   public:
+    using SampleBatch_t =
+        iox::cxx::vector<iox::popo::Sample<T>, iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY>;
     MockBasePublisher(const iox::capro::ServiceDescription&){};
     MOCK_CONST_METHOD0(getUid, iox::popo::uid_t());
     MOCK_CONST_METHOD0(getServiceDescription, iox::capro::ServiceDescription());
     MOCK_METHOD1_T(loan, iox::cxx::expected<iox::popo::Sample<T>, iox::popo::AllocationError>(uint32_t));
+    MOCK_METHOD2_T(loanN, iox::cxx::expected<SampleBatch_t, iox::popo::AllocationError>(uint32_t, uint32_t));
     MOCK_METHOD1_T(publishMocked, void(iox::popo::Sample<T>&&));
+    MOCK_METHOD1_T(publishN, void(SampleBatch_t&&));
     MOCK_METHOD0_T(loanPreviousSample, iox::cxx::optional<iox::popo::Sample<T>>());
     MOCK_METHOD0(offer, void(void));
     MOCK_METHOD0(stopOffer, void(void));
     MOCK_CONST_METHOD0(isOffered, bool(void));
     MOCK_CONST_METHOD0(hasSubscribers, bool(void));
+    MOCK_METHOD1(setChunkMagazineBatchSize, void(const uint32_t));
     void publish(iox::popo::Sample<T>&& sample) noexcept
     {
         return publishMocked(std::move(sample));
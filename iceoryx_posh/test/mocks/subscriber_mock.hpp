@@ -43,6 +43,7 @@ class MockSubscriberPortUser
         tryGetChunk,
         iox::cxx::expected<iox::cxx::optional<const iox::mepoo::ChunkHeader*>, iox::popo::ChunkReceiveError>());
     MOCK_METHOD1(releaseChunk, void(iox::mepoo::ChunkHeader*));
+    MOCK_METHOD2(releaseChunks, void(const iox::mepoo::ChunkHeader* const*, const uint32_t));
     MOCK_METHOD0(releaseQueuedChunks, void());
     MOCK_CONST_METHOD0(hasNewChunks, bool());
     MOCK_METHOD0(hasLostChunksSinceLastCall, bool());
@@ -56,6 +57,9 @@ template <typename T>
 class MockBaseSubscriber
 {
   public:
+    using SampleBatch_t =
+        iox::cxx::vector<iox::popo::Sample<const T>, iox::MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY>;
+
     MockBaseSubscriber(const iox::capro::ServiceDescription&){};
     MOCK_CONST_METHOD0(getUid, iox::popo::uid_t());
     MOCK_CONST_METHOD0(getServiceDescription, iox::capro::ServiceDescription());
@@ -67,6 +71,7 @@ class MockBaseSubscriber
     MOCK_METHOD0_T(take,
                    iox::cxx::expected<iox::cxx::optional<iox::popo::Sample<const T>>, iox::popo::ChunkReceiveError>());
     MOCK_METHOD0(releaseQueuedSamples, void());
+    MOCK_METHOD1_T(releaseN, void(SampleBatch_t&&));
     MOCK_METHOD1(setConditionVariable, bool(iox::popo::ConditionVariableData*));
     MOCK_METHOD0(unsetConditionVariable, bool(void));
     MOCK_METHOD0(hasTriggered, bool(void));
@@ -0,0 +1,525 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/internal/mepoo/chunk_magazine.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iceoryx_utils/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "test.hpp"
+
+#include <atomic>
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace ::testing;
+
+using iox::mepoo::ChunkMagazine;
+using iox::mepoo::MemPool;
+
+/// @brief exposes the slot operations to interleave an owner and a concurrent reclaim deterministically
+class MemPoolWithMagazineSlotAccess : public MemPool
+{
+  public:
+    using MemPool::MemPool;
+
+    using MemPool::acquireMagazineSlot;
+    using MemPool::detachMagazineSlotChunks;
+    using MemPool::flushMagazineSlot;
+    using MemPool::loadMagazineSlotState;
+    using MemPool::reclaimStashedChunk;
+    using MemPool::refillMagazineSlot;
+    using MemPool::releaseMagazineSlots;
+};
+
+class alignas(32) ChunkMagazine_test : public Test
+{
+  public:
+    static constexpr uint32_t NumberOfChunks{64};
+    static constexpr uint32_t ChunkSize{64};
+    static constexpr uint32_t BatchSize{4};
+    static constexpr uint32_t NumberOfMagazines{4};
+
+    static constexpr uint32_t LoFFLiMemoryRequirement{
+        MemPool::freeList_t::requiredMemorySize(NumberOfChunks) + 10000};
+    static constexpr uint32_t MemorySize{NumberOfChunks * ChunkSize + LoFFLiMemoryRequirement + 32 * 1024};
+
+    ChunkMagazine_test()
+        : allocator(m_rawMemory, MemorySize)
+        , memPool(ChunkSize, NumberOfChunks, &allocator, &allocator, NumberOfMagazines)
+    {
+    }
+
+    void SetUp(){};
+    void TearDown()
+    {
+        sut.flush();
+    };
+
+    alignas(32) uint8_t m_rawMemory[MemorySize];
+    iox::posix::Allocator allocator;
+
+    MemPoolWithMagazineSlotAccess memPool;
+    ChunkMagazine sut;
+};
+
+TEST_F(ChunkMagazine_test, IsDisabledByDefault)
+{
+    EXPECT_THAT(sut.getBatchSize(), Eq(0u));
+
+    EXPECT_THAT(sut.getChunk(memPool), Ne(nullptr));
+    EXPECT_THAT(sut.size(), Eq(0u));
+    EXPECT_THAT(memPool.getUsedChunks(), Eq(1u));
+}
+
+TEST_F(ChunkMagazine_test, BatchSizeIsLimitedToCapacity)
+{
+    sut.setBatchSize(ChunkMagazine::CAPACITY + 1u);
+    EXPECT_THAT(sut.getBatchSize(), Eq(ChunkMagazine::CAPACITY));
+}
+
+TEST_F(ChunkMagazine_test, MemPoolWithoutMagazineSlotsRequiresNoMagazineMemory)
+{
+    EXPECT_THAT(MemPool::requiredChunkMagazineMemorySize(0u), Eq(0u));
+    EXPECT_THAT(MemPool::requiredChunkMagazineMemorySize(NumberOfMagazines), Gt(0u));
+}
+
+TEST_F(ChunkMagazine_test, MagazineIsNotUsedWhenMemPoolHasNoSlots)
+{
+    alignas(32) uint8_t rawMemory[NumberOfChunks * ChunkSize + LoFFLiMemoryRequirement];
+    iox::posix::Allocator otherAllocator(rawMemory, NumberOfChunks * ChunkSize + LoFFLiMemoryRequirement);
+    MemPool memPoolWithoutSlots(ChunkSize, NumberOfChunks, &otherAllocator, &otherAllocator);
+
+    sut.setBatchSize(BatchSize);
+    EXPECT_THAT(sut.getChunk(memPoolWithoutSlots), Ne(nullptr));
+
+    EXPECT_THAT(sut.size(), Eq(0u));
+    EXPECT_THAT(memPoolWithoutSlots.getStashedChunks(), Eq(0u));
+    EXPECT_THAT(memPoolWithoutSlots.getUsedChunks(), Eq(1u));
+}
+
+TEST_F(ChunkMagazine_test, GetChunkStashesOneBatch)
+{
+    sut.setBatchSize(BatchSize);
+
+    EXPECT_THAT(sut.getChunk(memPool), Ne(nullptr));
+
+    EXPECT_THAT(sut.size(), Eq(BatchSize - 1u));
+    EXPECT_THAT(memPool.getUsedChunks(), Eq(1u));
+}
+
+TEST_F(ChunkMagazine_test, StashedChunksAreNotAccountedAsUsed)
+{
+    sut.setBatchSize(BatchSize);
+
+    for (uint32_t i = 0; i < BatchSize + 1u; ++i)
+    {
+        EXPECT_THAT(sut.getChunk(memPool), Ne(nullptr));
+        EXPECT_THAT(memPool.getUsedChunks(), Eq(i + 1u));
+        EXPECT_THAT(memPool.getInfo().m_usedChunks, Eq(i + 1u));
+    }
+    EXPECT_THAT(sut.size(), Eq(BatchSize - 1u));
+}
+
+TEST_F(ChunkMagazine_test, StashedChunksAreAccountedAsFreeForMinFree)
+{
+    sut.setBatchSize(BatchSize);
+
+    for (uint32_t i = 0; i < BatchSize + 1u; ++i)
+    {
+        ASSERT_THAT(sut.getChunk(memPool), Ne(nullptr));
+        EXPECT_THAT(memPool.getMinFree(), Eq(NumberOfChunks - (i + 1u)));
+        EXPECT_THAT(memPool.getInfo().m_minFreeChunks, Eq(NumberOfChunks - (i + 1u)));
+    }
+}
+
+TEST_F(ChunkMagazine_test, StashesOfAllMagazinesDoNotReduceMinFree)
+{
+    std::vector<std::unique_ptr<ChunkMagazine>> magazines;
+    std::vector<void*> chunks;
+    for (uint32_t i = 0; i < NumberOfMagazines; ++i)
+    {
+        magazines.emplace_back(new ChunkMagazine);
+        magazines.back()->setBatchSize(ChunkMagazine::CAPACITY);
+        chunks.push_back(magazines.back()->getChunk(memPool));
+        ASSERT_THAT(chunks.back(), Ne(nullptr));
+    }
+    for (auto chunk : chunks)
+    {
+        memPool.freeChunk(chunk);
+    }
+
+    EXPECT_THAT(memPool.getStashedChunks(), Gt(0u));
+    EXPECT_THAT(memPool.getUsedChunks(), Eq(0u));
+    EXPECT_THAT(memPool.getMinFree(), Eq(NumberOfChunks - NumberOfMagazines));
+
+    for (auto& magazine : magazines)
+    {
+        magazine->flush();
+    }
+}
+
+TEST_F(ChunkMagazine_test, ChunksAreHandedOutInOrderOfTheFreeList)
+{
+    sut.setBatchSize(BatchSize);
+
+    auto firstChunk = static_cast<uint8_t*>(sut.getChunk(memPool));
+    auto secondChunk = static_cast<uint8_t*>(sut.getChunk(memPool));
+
+    EXPECT_THAT(secondChunk, Eq(firstChunk + ChunkSize));
+}
+
+TEST_F(ChunkMagazine_test, AllChunksCanBeAcquiredAndAreUnique)
+{
+    sut.setBatchSize(BatchSize - 1u);
+
+    std::set<void*> chunks;
+    for (uint32_t i = 0; i < NumberOfChunks; ++i)
+    {
+        auto chunk = sut.getChunk(memPool);
+        ASSERT_THAT(chunk, Ne(nullptr));
+        chunks.insert(chunk);
+    }
+
+    EXPECT_THAT(chunks.size(), Eq(NumberOfChunks));
+    EXPECT_THAT(sut.getChunk(memPool), Eq(nullptr));
+    EXPECT_THAT(memPool.getUsedChunks(), Eq(NumberOfChunks));
+    EXPECT_THAT(memPool.getMinFree(), Eq(0u));
+}
+
+TEST_F(ChunkMagazine_test, FreeChunkReturnsHandedOutChunkToMemPool)
+{
+    sut.setBatchSize(BatchSize);
+
+    auto chunk = sut.getChunk(memPool);
+    memPool.freeChunk(chunk);
+
+    EXPECT_THAT(memPool.getUsedChunks(), Eq(0u));
+    EXPECT_THAT(sut.size(), Eq(BatchSize - 1u));
+}
+
+TEST_F(ChunkMagazine_test, FlushReturnsStashedChunksToMemPool)
+{
+    sut.setBatchSize(BatchSize);
+    ASSERT_THAT(sut.getChunk(memPool), Ne(nullptr));
+
+    sut.flush();
+
+    EXPECT_THAT(sut.size(), Eq(0u));
+    EXPECT_THAT(memPool.getUsedChunks(), Eq(1u));
+    EXPECT_THAT(memPool.getStashedChunks(), Eq(0u));
+
+    std::vector<void*> chunks;
+    while (auto chunk = memPool.getChunk())
+    {
+        chunks.push_back(chunk);
+    }
+    EXPECT_THAT(chunks.size(), Eq(NumberOfChunks - 1u));
+}
+
+TEST_F(ChunkMagazine_test, DestructorDoesNotTouchTheMemPool)
+{
+    {
+        ChunkMagazine magazine;
+        magazine.setBatchSize(BatchSize);
+        ASSERT_THAT(magazine.getChunk(memPool), Ne(nullptr));
+    }
+
+    EXPECT_THAT(memPool.getStashedChunks(), Eq(BatchSize - 1u));
+}
+
+TEST_F(ChunkMagazine_test, SwitchingTheMemPoolFlushesTheStash)
+{
+    alignas(32) uint8_t rawMemory[MemorySize];
+    iox::posix::Allocator otherAllocator(rawMemory, MemorySize);
+    MemPool otherMemPool(ChunkSize, NumberOfChunks, &otherAllocator, &otherAllocator, NumberOfMagazines);
+
+    sut.setBatchSize(BatchSize);
+    ASSERT_THAT(sut.getChunk(memPool), Ne(nullptr));
+    ASSERT_THAT(sut.getChunk(otherMemPool), Ne(nullptr));
+
+    EXPECT_THAT(sut.size(), Eq(BatchSize - 1u));
+    EXPECT_THAT(memPool.getStashedChunks(), Eq(0u));
+    EXPECT_THAT(memPool.getUsedChunks(), Eq(1u));
+    EXPECT_THAT(otherMemPool.getUsedChunks(), Eq(1u));
+
+    sut.flush();
+}
+
+TEST_F(ChunkMagazine_test, MagazineWorksWithoutStashWhenAllSlotsAreUsed)
+{
+    std::vector<std::unique_ptr<ChunkMagazine>> magazines;
+    for (uint32_t i = 0; i < memPool.getChunkMagazineCount(); ++i)
+    {
+        magazines.emplace_back(new ChunkMagazine);
+        magazines.back()->setBatchSize(1u);
+        ASSERT_THAT(magazines.back()->getChunk(memPool), Ne(nullptr));
+    }
+
+    sut.setBatchSize(BatchSize);
+    EXPECT_THAT(sut.getChunk(memPool), Ne(nullptr));
+    EXPECT_THAT(sut.size(), Eq(0u));
+    EXPECT_THAT(memPool.getUsedChunks(), Eq(NumberOfMagazines + 1u));
+
+    for (auto& magazine : magazines)
+    {
+        magazine->flush();
+    }
+}
+
+TEST_F(ChunkMagazine_test, MagazineAcquiresSlotWhenItBecomesFree)
+{
+    std::vector<std::unique_ptr<ChunkMagazine>> magazines;
+    for (uint32_t i = 0; i < memPool.getChunkMagazineCount(); ++i)
+    {
+        magazines.emplace_back(new ChunkMagazine);
+        magazines.back()->setBatchSize(1u);
+        ASSERT_THAT(magazines.back()->getChunk(memPool), Ne(nullptr));
+    }
+    sut.setBatchSize(BatchSize);
+    ASSERT_THAT(sut.getChunk(memPool), Ne(nullptr));
+    ASSERT_THAT(sut.size(), Eq(0u));
+
+    magazines.back()->flush();
+
+    EXPECT_THAT(sut.getChunk(memPool), Ne(nullptr));
+    EXPECT_THAT(sut.size(), Eq(BatchSize - 1u));
+
+    for (auto& magazine : magazines)
+    {
+        magazine->flush();
+    }
+}
+
+TEST_F(ChunkMagazine_test, BatchIsLimitedToShareOfMemPool)
+{
+    sut.setBatchSize(ChunkMagazine::CAPACITY);
+
+    EXPECT_THAT(sut.getChunk(memPool), Ne(nullptr));
+
+    EXPECT_THAT(sut.size(), Eq(NumberOfChunks / MemPool::CHUNK_MAGAZINE_SHARE_DIVISOR - 1u));
+}
+
+TEST_F(ChunkMagazine_test, StashedChunksAreReportedByMemPool)
+{
+    sut.setBatchSize(BatchSize);
+    ASSERT_THAT(sut.getChunk(memPool), Ne(nullptr));
+
+    EXPECT_THAT(memPool.getStashedChunks(), Eq(BatchSize - 1u));
+    EXPECT_THAT(memPool.getInfo().m_stashedChunks, Eq(BatchSize - 1u));
+}
+
+TEST_F(ChunkMagazine_test, GetChunksDrainsTheStashBeforeTakingChunksFromTheFreeList)
+{
+    sut.setBatchSize(BatchSize);
+    ASSERT_THAT(sut.getChunk(memPool), Ne(nullptr));
+    ASSERT_THAT(sut.size(), Eq(BatchSize - 1u));
+
+    constexpr uint32_t NumberOfRequestedChunks{2u * BatchSize};
+    void* chunks[NumberOfRequestedChunks];
+    EXPECT_THAT(sut.getChunks(memPool, chunks, NumberOfRequestedChunks), Eq(NumberOfRequestedChunks));
+
+    EXPECT_THAT(sut.size(), Eq(0u));
+    EXPECT_THAT(memPool.getStashedChunks(), Eq(0u));
+    EXPECT_THAT(memPool.getUsedChunks(), Eq(NumberOfRequestedChunks + 1u));
+    EXPECT_THAT(std::set<void*>(chunks, chunks + NumberOfRequestedChunks).size(), Eq(NumberOfRequestedChunks));
+}
+
+TEST_F(ChunkMagazine_test, GetChunksWhenMemPoolIsExhaustedReturnsTheRemainingChunks)
+{
+    sut.setBatchSize(BatchSize);
+    ASSERT_THAT(sut.getChunk(memPool), Ne(nullptr));
+
+    void* chunks[NumberOfChunks];
+    EXPECT_THAT(sut.getChunks(memPool, chunks, NumberOfChunks), Eq(NumberOfChunks - 1u));
+    EXPECT_THAT(memPool.getUsedChunks(), Eq(NumberOfChunks));
+}
+
+TEST_F(ChunkMagazine_test, MemPoolReclaimsStashedChunksWhenFreeListIsEmpty)
+{
+    sut.setBatchSize(BatchSize);
+    ASSERT_THAT(sut.getChunk(memPool), Ne(nullptr));
+
+    std::set<void*> chunks;
+    for (uint32_t i = 0; i < NumberOfChunks - 1u; ++i)
+    {
+        auto chunk = memPool.getChunk();
+        ASSERT_THAT(chunk, Ne(nullptr));
+        chunks.insert(chunk);
+    }
+
+    EXPECT_THAT(chunks.size(), Eq(NumberOfChunks - 1u));
+    EXPECT_THAT(sut.size(), Eq(0u));
+    EXPECT_THAT(memPool.getStashedChunks(), Eq(0u));
+    EXPECT_THAT(memPool.getUsedChunks(), Eq(NumberOfChunks));
+    EXPECT_THAT(memPool.getChunk(), Eq(nullptr));
+}
+
+TEST_F(ChunkMagazine_test, MagazineReclaimsStashedChunksOfOtherMagazinesWhenFreeListIsEmpty)
+{
+    ChunkMagazine otherMagazine;
+    otherMagazine.setBatchSize(BatchSize);
+    ASSERT_THAT(otherMagazine.getChunk(memPool), Ne(nullptr));
+
+    sut.setBatchSize(BatchSize);
+    std::set<void*> chunks;
+    for (uint32_t i = 0; i < NumberOfChunks - 1u; ++i)
+    {
+        auto chunk = sut.getChunk(memPool);
+        ASSERT_THAT(chunk, Ne(nullptr));
+        chunks.insert(chunk);
+    }
+
+    EXPECT_THAT(chunks.size(), Eq(NumberOfChunks - 1u));
+    EXPECT_THAT(otherMagazine.size(), Eq(0u));
+    EXPECT_THAT(sut.getChunk(memPool), Eq(nullptr));
+    otherMagazine.flush();
+}
+
+TEST_F(ChunkMagazine_test, ConcurrentReclaimRefillAndFlushNeitherLoseNorDuplicateChunks)
+{
+    constexpr uint32_t NumberOfIterations{5000u};
+    std::vector<std::atomic<uint32_t>> owners(NumberOfChunks);
+    for (auto& owner : owners)
+    {
+        owner.store(0u);
+    }
+    std::atomic<uint32_t> numberOfDuplicates{0u};
+
+    std::atomic<uintptr_t> baseAddress{0u};
+    {
+        // the chunks are located consecutively, the address of the first one is the base for the index calculation
+        uintptr_t lowest = UINTPTR_MAX;
+        std::vector<void*> chunks;
+        while (auto chunk = memPool.getChunk())
+        {
+            lowest = std::min(lowest, reinterpret_cast<uintptr_t>(chunk));
+            chunks.push_back(chunk);
+        }
+        for (auto chunk : chunks)
+        {
+            memPool.freeChunk(chunk);
+        }
+        baseAddress.store(lowest);
+    }
+    auto toIndex = [&](void* chunk) {
+        return static_cast<uint32_t>((reinterpret_cast<uintptr_t>(chunk) - baseAddress.load()) / ChunkSize);
+    };
+
+    auto use = [&](void* chunk) {
+        if (owners[toIndex(chunk)].fetch_add(1u) != 0u)
+        {
+            ++numberOfDuplicates;
+        }
+        owners[toIndex(chunk)].fetch_sub(1u);
+        memPool.freeChunk(chunk);
+    };
+
+    auto magazineWorker = [&] {
+        ChunkMagazine magazine;
+        magazine.setBatchSize(ChunkMagazine::CAPACITY);
+        for (uint32_t i = 0; i < NumberOfIterations; ++i)
+        {
+            std::vector<void*> chunks;
+            for (uint32_t k = 0; k < BatchSize; ++k)
+            {
+                if (auto chunk = magazine.getChunk(memPool))
+                {
+                    chunks.push_back(chunk);
+                }
+            }
+            for (auto chunk : chunks)
+            {
+                use(chunk);
+            }
+            if (i % 64u == 0u)
+            {
+                magazine.flush();
+            }
+        }
+        magazine.flush();
+    };
+
+    auto reclaimWorker = [&] {
+        for (uint32_t i = 0; i < NumberOfIterations; ++i)
+        {
+            // drains the free list so that getChunk has to reclaim from the stashes
+            std::vector<void*> chunks;
+            while (auto chunk = memPool.getChunk())
+            {
+                chunks.push_back(chunk);
+                if (chunks.size() >= NumberOfChunks / 2u)
+                {
+                    break;
+                }
+            }
+            for (auto chunk : chunks)
+            {
+                use(chunk);
+            }
+        }
+    };
+
+    std::thread magazineThread1(magazineWorker);
+    std::thread magazineThread2(magazineWorker);
+    std::thread reclaimThread(reclaimWorker);
+    magazineThread1.join();
+    magazineThread2.join();
+    reclaimThread.join();
+
+    EXPECT_THAT(numberOfDuplicates.load(), Eq(0u));
+    EXPECT_THAT(memPool.getUsedChunks(), Eq(0u));
+    EXPECT_THAT(memPool.getStashedChunks(), Eq(0u));
+
+    std::set<void*> chunks;
+    while (auto chunk = memPool.getChunk())
+    {
+        chunks.insert(chunk);
+    }
+    EXPECT_THAT(chunks.size(), Eq(NumberOfChunks));
+}
+
+TEST_F(ChunkMagazine_test, FlushWhichLosesTheRaceAgainstReclaimDoesNotReturnTheReclaimedChunks)
+{
+    constexpr uint64_t Owner{42u};
+    auto slot = memPool.acquireMagazineSlot(Owner);
+    ASSERT_TRUE(slot.has_value());
+    ASSERT_THAT(memPool.refillMagazineSlot(*slot, 1u), Eq(1u));
+
+    // the owner observes the stash, a concurrent reclaim empties it before the owner detaches the chunks
+    const uint64_t observedState = memPool.loadMagazineSlotState(*slot);
+    void* reclaimedChunk = memPool.reclaimStashedChunk();
+    ASSERT_THAT(reclaimedChunk, Ne(nullptr));
+
+    EXPECT_THAT(memPool.detachMagazineSlotChunks(*slot, observedState), Eq(0u));
+    memPool.flushMagazineSlot(*slot);
+
+    EXPECT_THAT(memPool.getStashedChunks(), Eq(0u));
+    EXPECT_THAT(memPool.getUsedChunks(), Eq(1u));
+
+    std::set<void*> remainingChunks;
+    void* chunk{nullptr};
+    while ((chunk = memPool.getChunk()) != nullptr)
+    {
+        remainingChunks.insert(chunk);
+    }
+    EXPECT_THAT(remainingChunks.size(), Eq(NumberOfChunks - 1u));
+    EXPECT_THAT(remainingChunks.count(reclaimedChunk), Eq(0u));
+    for (auto c : remainingChunks)
+    {
+        memPool.freeChunk(c);
+    }
+    memPool.freeChunk(reclaimedChunk);
+    memPool.releaseMagazineSlots(Owner);
+}
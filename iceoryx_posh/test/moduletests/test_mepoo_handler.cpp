@@ -14,9 +14,13 @@
 
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iceoryx_utils/cxx/optional.hpp"
+#include "iceoryx_utils/error_handling/error_handling.hpp"
 #include "iceoryx_utils/internal/posix_wrapper/shared_memory_object/allocator.hpp"
 #include "test.hpp"
 
+#include <limits>
+
 using namespace ::testing;
 
 class MemoryManager_test : public Test
@@ -69,6 +73,26 @@ TEST_F(MemoryManager_test, getMempoolChunkSizeForPayloadSize)
     EXPECT_THAT(sut->getMempoolChunkSizeForPayloadSize(50), Eq(adjustedChunkSize(64u)));
 }
 
+TEST_F(MemoryManager_test, getMempoolChunkSizeForPayloadSizeWithSeveralMemPoolsInOneSizeClass)
+{
+    mempoolconf.addMemPool({32, 10});
+    mempoolconf.addMemPool({320, 10});
+    mempoolconf.addMemPool({352, 10});
+    mempoolconf.addMemPool({416, 10});
+    mempoolconf.addMemPool({4096, 10});
+    sut->configureMemoryManager(mempoolconf, allocator, allocator);
+
+    EXPECT_THAT(sut->getMempoolChunkSizeForPayloadSize(1), Eq(adjustedChunkSize(32u)));
+    EXPECT_THAT(sut->getMempoolChunkSizeForPayloadSize(32), Eq(adjustedChunkSize(32u)));
+    EXPECT_THAT(sut->getMempoolChunkSizeForPayloadSize(33), Eq(adjustedChunkSize(320u)));
+    EXPECT_THAT(sut->getMempoolChunkSizeForPayloadSize(321), Eq(adjustedChunkSize(352u)));
+    EXPECT_THAT(sut->getMempoolChunkSizeForPayloadSize(352), Eq(adjustedChunkSize(352u)));
+    EXPECT_THAT(sut->getMempoolChunkSizeForPayloadSize(353), Eq(adjustedChunkSize(416u)));
+    EXPECT_THAT(sut->getMempoolChunkSizeForPayloadSize(417), Eq(adjustedChunkSize(4096u)));
+    EXPECT_THAT(sut->getMempoolChunkSizeForPayloadSize(4096), Eq(adjustedChunkSize(4096u)));
+    EXPECT_THAT(sut->getMempoolChunkSizeForPayloadSize(4097), Eq(0u));
+}
+
 TEST_F(MemoryManager_test, getChunkSizeForWrongSampleSize)
 {
     mempoolconf.addMemPool({32, 10});
@@ -326,3 +350,304 @@ TEST_F(MemoryManager_test, addMemPoolWithChunkCountZeroShouldFail)
     mempoolconf.addMemPool({32, 0});
     EXPECT_DEATH({ sut->configureMemoryManager(mempoolconf, allocator, allocator); }, ".*");
 }
+
+TEST_F(MemoryManager_test, getChunkWithStrictFallbackPolicyFailsIfFittingMemPoolIsExhausted)
+{
+    mempoolconf.addMemPool({32, 1});
+    mempoolconf.addMemPool({64, 1});
+    sut->configureMemoryManager(mempoolconf, allocator, allocator);
+
+    auto chunk = sut->getChunk(32);
+    ASSERT_THAT(chunk, Eq(true));
+
+    EXPECT_THAT(sut->getFallbackPolicy(), Eq(iox::mepoo::MemPoolFallbackPolicy::STRICT));
+    EXPECT_THAT(sut->getChunk(32), Eq(false));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(0u));
+}
+
+TEST_F(MemoryManager_test, getChunkWithNextLargerFallbackPolicyUsesNextLargerMemPool)
+{
+    mempoolconf.addMemPool({32, 1});
+    mempoolconf.addMemPool({64, 1});
+    mempoolconf.addMemPool({128, 1});
+    mempoolconf.m_fallbackPolicy = iox::mepoo::MemPoolFallbackPolicy::NEXT_LARGER;
+    sut->configureMemoryManager(mempoolconf, allocator, allocator);
+
+    auto chunk1 = sut->getChunk(32);
+    auto chunk2 = sut->getChunk(32);
+    ASSERT_THAT(chunk2, Eq(true));
+
+    EXPECT_THAT(chunk2.getChunkHeader()->m_info.m_totalSizeOfChunk, Eq(adjustedChunkSize(64u)));
+    EXPECT_THAT(chunk2.getChunkHeader()->m_info.m_payloadSize, Eq(32u));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(1u));
+    EXPECT_THAT(sut->getChunk(32), Eq(false));
+    EXPECT_THAT(sut->getMemPoolInfo(2).m_usedChunks, Eq(0u));
+}
+
+TEST_F(MemoryManager_test, getChunkWithAnyLargerFallbackPolicyUsesSmallestLargerMemPoolWithFreeChunks)
+{
+    mempoolconf.addMemPool({32, 1});
+    mempoolconf.addMemPool({64, 1});
+    mempoolconf.addMemPool({128, 1});
+    mempoolconf.m_fallbackPolicy = iox::mepoo::MemPoolFallbackPolicy::ANY_LARGER;
+    sut->configureMemoryManager(mempoolconf, allocator, allocator);
+
+    auto chunk1 = sut->getChunk(64);
+    auto chunk2 = sut->getChunk(32);
+    auto chunk3 = sut->getChunk(32);
+    ASSERT_THAT(chunk3, Eq(true));
+
+    EXPECT_THAT(chunk2.getChunkHeader()->m_info.m_totalSizeOfChunk, Eq(adjustedChunkSize(32u)));
+    EXPECT_THAT(chunk3.getChunkHeader()->m_info.m_totalSizeOfChunk, Eq(adjustedChunkSize(128u)));
+    EXPECT_THAT(sut->getChunk(32), Eq(false));
+}
+
+TEST_F(MemoryManager_test, getChunkFromFallbackMemPoolDoesNotWriteToStderr)
+{
+    mempoolconf.addMemPool({32, 1});
+    mempoolconf.addMemPool({64, 1});
+    mempoolconf.m_fallbackPolicy = iox::mepoo::MemPoolFallbackPolicy::NEXT_LARGER;
+    sut->configureMemoryManager(mempoolconf, allocator, allocator);
+
+    auto chunk1 = sut->getChunk(32);
+    internal::CaptureStderr();
+    auto chunk2 = sut->getChunk(32);
+    std::string output = internal::GetCapturedStderr();
+
+    EXPECT_THAT(chunk2, Eq(true));
+    EXPECT_THAT(output, Eq(""));
+}
+
+TEST_F(MemoryManager_test, getChunkWithFallbackWritesToStderrOnlyIfAllMemPoolsAreExhausted)
+{
+    mempoolconf.addMemPool({32, 1});
+    mempoolconf.addMemPool({64, 1});
+    mempoolconf.m_fallbackPolicy = iox::mepoo::MemPoolFallbackPolicy::NEXT_LARGER;
+    sut->configureMemoryManager(mempoolconf, allocator, allocator);
+
+    auto chunk1 = sut->getChunk(32);
+    auto chunk2 = sut->getChunk(32);
+    internal::CaptureStderr();
+    auto chunk3 = sut->getChunk(32);
+    std::string output = internal::GetCapturedStderr();
+
+    EXPECT_THAT(chunk3, Eq(false));
+    EXPECT_THAT(output, HasSubstr("unable to acquire a chunk"));
+}
+
+TEST_F(MemoryManager_test, freeChunkFromFallbackMemPoolReturnsItToThatMemPool)
+{
+    mempoolconf.addMemPool({32, 1});
+    mempoolconf.addMemPool({64, 1});
+    mempoolconf.m_fallbackPolicy = iox::mepoo::MemPoolFallbackPolicy::ANY_LARGER;
+    sut->configureMemoryManager(mempoolconf, allocator, allocator);
+
+    auto chunk1 = sut->getChunk(32);
+    {
+        auto chunk2 = sut->getChunk(32);
+        EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(1u));
+    }
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(1u));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(0u));
+}
+
+TEST_F(MemoryManager_test, getChunksInitializesAllChunks)
+{
+    constexpr uint32_t NumberOfChunks{4};
+    mempoolconf.addMemPool({32, 10});
+    mempoolconf.addMemPool({64, 10});
+    sut->configureMemoryManager(mempoolconf, allocator, allocator);
+
+    iox::mepoo::SharedChunk chunks[NumberOfChunks];
+    EXPECT_THAT(sut->getChunks(50, chunks, NumberOfChunks), Eq(NumberOfChunks));
+
+    for (auto& chunk : chunks)
+    {
+        ASSERT_THAT(chunk, Eq(true));
+        EXPECT_THAT(chunk.getChunkHeader()->m_info.m_payloadSize, Eq(50u));
+        EXPECT_THAT(chunk.getChunkHeader()->m_info.m_usedSizeOfChunk, Eq(adjustedChunkSize(50u)));
+        EXPECT_THAT(chunk.getChunkHeader()->m_info.m_totalSizeOfChunk, Eq(adjustedChunkSize(64u)));
+    }
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(NumberOfChunks));
+}
+
+TEST_F(MemoryManager_test, getChunksReturnsChunksToTheMemPoolsOnRelease)
+{
+    constexpr uint32_t NumberOfChunks{4};
+    mempoolconf.addMemPool({32, 10});
+    sut->configureMemoryManager(mempoolconf, allocator, allocator);
+
+    {
+        iox::mepoo::SharedChunk chunks[NumberOfChunks];
+        EXPECT_THAT(sut->getChunks(32, chunks, NumberOfChunks), Eq(NumberOfChunks));
+        EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(NumberOfChunks));
+    }
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(0u));
+}
+
+TEST_F(MemoryManager_test, getChunksWithFallbackPolicyTakesTheRemainingChunksFromLargerMemPool)
+{
+    mempoolconf.addMemPool({32, 2});
+    mempoolconf.addMemPool({64, 2});
+    mempoolconf.m_fallbackPolicy = iox::mepoo::MemPoolFallbackPolicy::NEXT_LARGER;
+    sut->configureMemoryManager(mempoolconf, allocator, allocator);
+
+    iox::mepoo::SharedChunk chunks[5];
+    EXPECT_THAT(sut->getChunks(32, chunks, 5u), Eq(4u));
+
+    EXPECT_THAT(chunks[1].getChunkHeader()->m_info.m_totalSizeOfChunk, Eq(adjustedChunkSize(32u)));
+    EXPECT_THAT(chunks[2].getChunkHeader()->m_info.m_totalSizeOfChunk, Eq(adjustedChunkSize(64u)));
+    EXPECT_THAT(chunks[4], Eq(false));
+}
+
+TEST_F(MemoryManager_test, getChunksWithInChunkLayoutStoresChunkManagementInFrontOfChunkHeader)
+{
+    constexpr uint32_t NumberOfChunks{3};
+    mempoolconf.addMemPool({32, 10});
+    mempoolconf.m_chunkManagementLayout = iox::mepoo::ChunkManagementLayout::IN_CHUNK;
+    sut->configureMemoryManager(mempoolconf, allocator, allocator);
+
+    iox::mepoo::SharedChunk chunks[NumberOfChunks];
+    EXPECT_THAT(sut->getChunks(32, chunks, NumberOfChunks), Eq(NumberOfChunks));
+
+    for (auto& chunk : chunks)
+    {
+        auto chunkHeader = chunk.getChunkHeader();
+        auto chunkManagement = chunk.release();
+        EXPECT_THAT(reinterpret_cast<uint8_t*>(chunkHeader),
+                    Eq(reinterpret_cast<uint8_t*>(chunkManagement) + sizeof(iox::mepoo::ChunkManagement)));
+        chunk = iox::mepoo::SharedChunk(chunkManagement);
+    }
+}
+
+TEST_F(MemoryManager_test, getChunkWithInChunkLayoutStoresChunkManagementInFrontOfChunkHeader)
+{
+    mempoolconf.addMemPool({32, 10});
+    mempoolconf.addMemPool({64, 10});
+    mempoolconf.m_chunkManagementLayout = iox::mepoo::ChunkManagementLayout::IN_CHUNK;
+    sut->configureMemoryManager(mempoolconf, allocator, allocator);
+
+    auto chunk = sut->getChunk(50);
+    ASSERT_THAT(chunk, Eq(true));
+
+    auto chunkHeader = chunk.getChunkHeader();
+    auto chunkManagement = chunk.release();
+    EXPECT_THAT(reinterpret_cast<uint8_t*>(chunkHeader),
+                Eq(reinterpret_cast<uint8_t*>(chunkManagement) + sizeof(iox::mepoo::ChunkManagement)));
+    chunk = iox::mepoo::SharedChunk(chunkManagement);
+
+    EXPECT_THAT(sut->getChunkManagementLayout(), Eq(iox::mepoo::ChunkManagementLayout::IN_CHUNK));
+    EXPECT_THAT(chunk.getChunkHeader()->m_info.m_totalSizeOfChunk, Eq(adjustedChunkSize(64u)));
+    EXPECT_THAT(sut->getMempoolChunkSizeForPayloadSize(50), Eq(adjustedChunkSize(64u)));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_chunkSize,
+                Eq(adjustedChunkSize(64u) + sizeof(iox::mepoo::ChunkManagement)));
+}
+
+TEST_F(MemoryManager_test, freeChunkWithInChunkLayoutReturnsChunkOnlyOnLastRelease)
+{
+    constexpr uint32_t ChunkCount{10};
+    mempoolconf.addMemPool({32, ChunkCount});
+    mempoolconf.m_chunkManagementLayout = iox::mepoo::ChunkManagementLayout::IN_CHUNK;
+    sut->configureMemoryManager(mempoolconf, allocator, allocator);
+
+    {
+        std::vector<iox::mepoo::SharedChunk> chunkStore;
+        for (size_t i = 0; i < ChunkCount; i++)
+        {
+            chunkStore.push_back(sut->getChunk(32));
+            EXPECT_THAT(chunkStore.back(), Eq(true));
+        }
+        EXPECT_THAT(sut->getChunk(32), Eq(false));
+
+        auto copy = chunkStore.front();
+        chunkStore.clear();
+        EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(1u));
+    }
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(0u));
+}
+
+TEST_F(MemoryManager_test, requiredMemorySizeWithInChunkLayoutMovesChunkManagementToChunkMemory)
+{
+    mempoolconf.addMemPool({32, 10});
+    auto inChunkConfig = mempoolconf;
+    inChunkConfig.m_chunkManagementLayout = iox::mepoo::ChunkManagementLayout::IN_CHUNK;
+
+    EXPECT_THAT(iox::mepoo::MemoryManager::requiredChunkMemorySize(inChunkConfig),
+                Eq(iox::mepoo::MemoryManager::requiredChunkMemorySize(mempoolconf)
+                   + 10u * sizeof(iox::mepoo::ChunkManagement)));
+    EXPECT_THAT(iox::mepoo::MemoryManager::requiredManagementMemorySize(inChunkConfig),
+                Lt(iox::mepoo::MemoryManager::requiredManagementMemorySize(mempoolconf)));
+}
+
+TEST_F(MemoryManager_test, getChunkWithInChunkLayoutNearMaximumSizeFailsWithChunkIsTooLarge)
+{
+    mempoolconf.addMemPool({32, 10});
+    mempoolconf.m_chunkManagementLayout = iox::mepoo::ChunkManagementLayout::IN_CHUNK;
+    sut->configureMemoryManager(mempoolconf, allocator, allocator);
+
+    iox::cxx::optional<iox::Error> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandler::SetTemporaryErrorHandler(
+        [&detectedError](const iox::Error error, const std::function<void()>, const iox::ErrorLevel) {
+            detectedError.emplace(error);
+        });
+
+    constexpr uint32_t MAX_PAYLOAD_SIZE = std::numeric_limits<uint32_t>::max() - sizeof(iox::mepoo::ChunkHeader);
+    auto chunk = sut->getChunk(MAX_PAYLOAD_SIZE);
+
+    EXPECT_THAT(chunk, Eq(false));
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_THAT(detectedError.value(), Eq(iox::Error::kMEPOO__MEMPOOL_GETCHUNK_CHUNK_IS_TOO_LARGE));
+    EXPECT_THAT(sut->getMempoolChunkSizeForPayloadSize(MAX_PAYLOAD_SIZE), Eq(0u));
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(0u));
+}
+
+TEST_F(MemoryManager_test, allocationProfileIsNotRecordedByDefault)
+{
+    mempoolconf.addMemPool({128, 10});
+    sut->configureMemoryManager(mempoolconf, allocator, allocator);
+
+    auto chunk = sut->getChunk(100);
+    ASSERT_THAT(chunk, Eq(true));
+
+    EXPECT_THAT(sut->isAllocationProfileRecorded(), Eq(false));
+    EXPECT_THAT(sut->getRequestedPayloadSizeCount(7u), Eq(0u));
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_maxRequestedPayloadSize, Eq(0u));
+}
+
+TEST_F(MemoryManager_test, allocationProfileRecordsRequestedPayloadSizesInPowerOfTwoBuckets)
+{
+    mempoolconf.addMemPool({128, 10});
+    mempoolconf.m_recordAllocationProfile = true;
+    sut->configureMemoryManager(mempoolconf, allocator, allocator);
+
+    auto chunk1 = sut->getChunk(64);
+    auto chunk2 = sut->getChunk(65);
+    auto chunk3 = sut->getChunk(100);
+    iox::mepoo::SharedChunk chunks[3];
+    EXPECT_THAT(sut->getChunks(128, chunks, 3u), Eq(3u));
+
+    EXPECT_THAT(sut->isAllocationProfileRecorded(), Eq(true));
+    EXPECT_THAT(sut->getRequestedPayloadSizeCount(6u), Eq(1u));
+    EXPECT_THAT(sut->getRequestedPayloadSizeCount(7u), Eq(5u));
+    EXPECT_THAT(sut->getRequestedPayloadSizeCount(iox::mepoo::ALLOCATION_PROFILE_NUMBER_OF_BUCKETS), Eq(0u));
+}
+
+TEST_F(MemoryManager_test, allocationProfileRecordsLargestPayloadSizeServedByEachMemPool)
+{
+    mempoolconf.addMemPool({32, 1});
+    mempoolconf.addMemPool({128, 10});
+    mempoolconf.m_fallbackPolicy = iox::mepoo::MemPoolFallbackPolicy::NEXT_LARGER;
+    mempoolconf.m_recordAllocationProfile = true;
+    sut->configureMemoryManager(mempoolconf, allocator, allocator);
+
+    auto chunk1 = sut->getChunk(20);
+    auto chunk2 = sut->getChunk(24);
+    auto chunk3 = sut->getChunk(90);
+    auto chunk4 = sut->getChunk(60);
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_maxRequestedPayloadSize, Eq(20u));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_maxRequestedPayloadSize, Eq(90u));
+}
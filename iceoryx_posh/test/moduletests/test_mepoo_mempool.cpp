@@ -16,6 +16,8 @@
 #include "iceoryx_utils/internal/posix_wrapper/shared_memory_object/allocator.hpp"
 #include "test.hpp"
 
+#include <set>
+
 using namespace ::testing;
 
 class alignas(32) MemPool_test : public Test
@@ -86,6 +88,33 @@ TEST_F(MemPool_test, GetChunkWhenFull)
     EXPECT_THAT(sut.getChunk(), Eq(nullptr));
 }
 
+TEST_F(MemPool_test, getChunksReturnsDistinctChunksAndAccountsThemAsUsed)
+{
+    // more than one batched pop is required
+    constexpr uint32_t RequestedChunks{iox::CHUNK_MAGAZINE_CAPACITY + 2u};
+    void* chunks[RequestedChunks];
+
+    EXPECT_THAT(sut.getChunks(chunks, RequestedChunks), Eq(RequestedChunks));
+
+    EXPECT_THAT(sut.getUsedChunks(), Eq(RequestedChunks));
+    EXPECT_THAT(sut.getMinFree(), Eq(NumberOfChunks - RequestedChunks));
+    std::set<void*> distinctChunks(&chunks[0], &chunks[RequestedChunks]);
+    EXPECT_THAT(distinctChunks.size(), Eq(RequestedChunks));
+}
+
+TEST_F(MemPool_test, getChunksWhenAlmostFullReturnsTheRemainingChunks)
+{
+    for (uint32_t i = 0; i < NumberOfChunks - 2u; i++)
+    {
+        sut.getChunk();
+    }
+    void* chunks[4];
+
+    EXPECT_THAT(sut.getChunks(chunks, 4u), Eq(2u));
+    EXPECT_THAT(sut.getUsedChunks(), Eq(NumberOfChunks));
+    EXPECT_THAT(sut.getChunks(chunks, 4u), Eq(0u));
+}
+
 TEST_F(MemPool_test, getChunkSize)
 {
     EXPECT_THAT(sut.getChunkSize(), Eq(ChunkSize));
@@ -39,19 +39,32 @@ class MePooSegment_test : public Test
                                              const iox::posix::AccessMode,
                                              const iox::posix::OwnerShip,
                                              const void*,
-                                             const mode_t)>;
+                                             const mode_t,
+                                             const iox::posix::PageType,
+                                             const iox::posix::PageFaultPolicy,
+                                             const uint32_t)>;
         static iox::cxx::optional<SharedMemoryObject_MOCK>
         create(const char* f_name,
                const uint64_t f_memorySizeInBytes,
                const iox::posix::AccessMode f_accessMode,
                const iox::posix::OwnerShip f_ownerShip,
                void* f_baseAddressHint,
-               const mode_t f_permissions = S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH)
+               const mode_t f_permissions = S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH,
+               const iox::posix::PageType f_pageType = iox::posix::PageType::normal,
+               const iox::posix::PageFaultPolicy f_pageFaultPolicy = iox::posix::PageFaultPolicy::onDemand,
+               const uint32_t f_numaNode = iox::posix::MemoryMap::ANY_NUMA_NODE)
         {
             if (createVerificator)
             {
-                createVerificator(
-                    f_name, f_memorySizeInBytes, f_accessMode, f_ownerShip, f_baseAddressHint, f_permissions);
+                createVerificator(f_name,
+                                  f_memorySizeInBytes,
+                                  f_accessMode,
+                                  f_ownerShip,
+                                  f_baseAddressHint,
+                                  f_permissions,
+                                  f_pageType,
+                                  f_pageFaultPolicy,
+                                  f_numaNode);
             }
             return SharedMemoryObject_MOCK(f_memorySizeInBytes, f_baseAddressHint);
         }
@@ -138,10 +151,14 @@ TEST_F(MePooSegment_test, ADD_TEST_WITH_ADDITIONAL_USER(SharedMemoryCreationPara
                                                                        const iox::posix::AccessMode f_accessMode,
                                                                        const iox::posix::OwnerShip f_ownerShip,
                                                                        const void*,
-                                                                       const mode_t) {
+                                                                       const mode_t,
+                                                                       const iox::posix::PageType f_pageType,
+                                                                       const iox::posix::PageFaultPolicy,
+                                                                       const uint32_t) {
         EXPECT_THAT(std::string(f_name), Eq(std::string("/roudi_test2")));
         EXPECT_THAT(f_accessMode, Eq(iox::posix::AccessMode::readWrite));
         EXPECT_THAT(f_ownerShip, Eq(iox::posix::OwnerShip::mine));
+        EXPECT_THAT(f_pageType, Eq(iox::posix::PageType::normal));
     };
     MePooSegment<SharedMemoryObject_MOCK, MemoryManager> sut2{
         mepooConfig, &m_managementAllocator, {"roudi_test1"}, {"roudi_test2"}};
@@ -149,6 +166,87 @@ TEST_F(MePooSegment_test, ADD_TEST_WITH_ADDITIONAL_USER(SharedMemoryCreationPara
         MePooSegment_test::SharedMemoryObject_MOCK::createFct();
 }
 
+TEST_F(MePooSegment_test, ADD_TEST_WITH_ADDITIONAL_USER(SharedMemoryCreationWithHugePages))
+{
+    iox::posix::PageType pageType{iox::posix::PageType::normal};
+    MePooSegment_test::SharedMemoryObject_MOCK::createVerificator = [&](const char*,
+                                                                        const uint64_t,
+                                                                        const iox::posix::AccessMode,
+                                                                        const iox::posix::OwnerShip,
+                                                                        const void*,
+                                                                        const mode_t,
+                                                                        const iox::posix::PageType f_pageType,
+                                                                        const iox::posix::PageFaultPolicy,
+                                                                        const uint32_t) {
+        pageType = f_pageType;
+    };
+    MePooSegment<SharedMemoryObject_MOCK, MemoryManager> sut2{mepooConfig,
+                                                              &m_managementAllocator,
+                                                              {"roudi_test1"},
+                                                              {"roudi_test2"},
+                                                              iox::mepoo::MemoryInfo(),
+                                                              iox::posix::PageType::huge};
+    MePooSegment_test::SharedMemoryObject_MOCK::createVerificator =
+        MePooSegment_test::SharedMemoryObject_MOCK::createFct();
+
+    EXPECT_THAT(pageType, Eq(iox::posix::PageType::huge));
+    EXPECT_THAT(sut2.getPageType(), Eq(iox::posix::PageType::huge));
+}
+
+TEST_F(MePooSegment_test, ADD_TEST_WITH_ADDITIONAL_USER(SharedMemoryCreationWithLockedPages))
+{
+    iox::posix::PageFaultPolicy pageFaultPolicy{iox::posix::PageFaultPolicy::onDemand};
+    MePooSegment_test::SharedMemoryObject_MOCK::createVerificator =
+        [&](const char*,
+            const uint64_t,
+            const iox::posix::AccessMode,
+            const iox::posix::OwnerShip,
+            const void*,
+            const mode_t,
+            const iox::posix::PageType,
+            const iox::posix::PageFaultPolicy f_pageFaultPolicy,
+            const uint32_t) { pageFaultPolicy = f_pageFaultPolicy; };
+    MePooSegment<SharedMemoryObject_MOCK, MemoryManager> sut2{mepooConfig,
+                                                              &m_managementAllocator,
+                                                              {"roudi_test1"},
+                                                              {"roudi_test2"},
+                                                              iox::mepoo::MemoryInfo(),
+                                                              iox::posix::PageType::normal,
+                                                              iox::posix::PageFaultPolicy::lock};
+    MePooSegment_test::SharedMemoryObject_MOCK::createVerificator =
+        MePooSegment_test::SharedMemoryObject_MOCK::createFct();
+
+    EXPECT_THAT(pageFaultPolicy, Eq(iox::posix::PageFaultPolicy::lock));
+    EXPECT_THAT(sut2.getPageFaultPolicy(), Eq(iox::posix::PageFaultPolicy::lock));
+}
+
+TEST_F(MePooSegment_test, ADD_TEST_WITH_ADDITIONAL_USER(SharedMemoryCreationOnNumaNode))
+{
+    std::string name;
+    uint32_t numaNode{iox::posix::MemoryMap::ANY_NUMA_NODE};
+    MePooSegment_test::SharedMemoryObject_MOCK::createVerificator = [&](const char* f_name,
+                                                                        const uint64_t,
+                                                                        const iox::posix::AccessMode,
+                                                                        const iox::posix::OwnerShip,
+                                                                        const void*,
+                                                                        const mode_t,
+                                                                        const iox::posix::PageType,
+                                                                        const iox::posix::PageFaultPolicy,
+                                                                        const uint32_t f_numaNode) {
+        name = f_name;
+        numaNode = f_numaNode;
+    };
+    MePooSegment<SharedMemoryObject_MOCK, MemoryManager> sut2{
+        mepooConfig, &m_managementAllocator, {"roudi_test1"}, {"roudi_test2"}, iox::mepoo::MemoryInfo(0u, 0u, 1u)};
+    MePooSegment_test::SharedMemoryObject_MOCK::createVerificator =
+        MePooSegment_test::SharedMemoryObject_MOCK::createFct();
+
+    EXPECT_THAT(name, Eq(std::string("/roudi_test2_numa1")));
+    EXPECT_THAT(numaNode, Eq(1u));
+    EXPECT_THAT(std::string(sut2.getSharedMemoryName().c_str()), Eq(std::string("/roudi_test2_numa1")));
+    EXPECT_THAT(sut2.getMemoryInfo().numaNode, Eq(1u));
+}
+
 TEST_F(MePooSegment_test, ADD_TEST_WITH_ADDITIONAL_USER(GetSharedMemoryObject))
 {
     uint64_t memorySizeInBytes{0};
@@ -157,7 +255,10 @@ TEST_F(MePooSegment_test, ADD_TEST_WITH_ADDITIONAL_USER(GetSharedMemoryObject))
                                                                         const iox::posix::AccessMode,
                                                                         const iox::posix::OwnerShip,
                                                                         const void*,
-                                                                        const mode_t) {
+                                                                        const mode_t,
+                                                                        const iox::posix::PageType,
+                                                                        const iox::posix::PageFaultPolicy,
+                                                                        const uint32_t) {
         memorySizeInBytes = f_memorySizeInBytes;
     };
     MePooSegment<SharedMemoryObject_MOCK, MemoryManager> sut2{
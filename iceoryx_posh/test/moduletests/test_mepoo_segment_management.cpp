@@ -137,3 +137,71 @@ TEST_F(SegmentManager_test, ADD_TEST_WITH_ADDITIONAL_USER(getMemoryManagerForUse
 {
     EXPECT_THAT(sut.getSegmentInformationForUser({"no_user"}).m_memoryManager, Eq(nullptr));
 }
+
+TEST_F(SegmentManager_test, ADD_TEST_WITH_ADDITIONAL_USER(getSegmentMappingsWithSegmentsOnSeveralNumaNodes))
+{
+    SegmentConfig numaConfig;
+    numaConfig.m_sharedMemorySegments.push_back({"roudi_test1", "roudi_test2", mepooConfig, MemoryInfo(0u, 0u, 0u)});
+    numaConfig.m_sharedMemorySegments.push_back({"roudi_test1", "roudi_test2", mepooConfig, MemoryInfo(0u, 0u, 1u)});
+    SegmentManager<> numaSut{numaConfig, &allocator};
+
+    auto mapping = numaSut.getSegmentMappings({"roudi_test2"});
+    ASSERT_THAT(mapping.size(), Eq(2u));
+    EXPECT_THAT(mapping[0].m_isWritable, Eq(true));
+    EXPECT_THAT(mapping[1].m_isWritable, Eq(true));
+    EXPECT_THAT(mapping[0].m_memoryInfo.numaNode, Eq(0u));
+    EXPECT_THAT(mapping[1].m_memoryInfo.numaNode, Eq(1u));
+    EXPECT_THAT(mapping[0].m_sharedMemoryName == mapping[1].m_sharedMemoryName, Eq(false));
+}
+
+TEST_F(SegmentManager_test, ADD_TEST_WITH_ADDITIONAL_USER(getMemoryManagerForUserPrefersSegmentOnNumaNode))
+{
+    SegmentConfig numaConfig;
+    numaConfig.m_sharedMemorySegments.push_back({"roudi_test1", "roudi_test2", mepooConfig, MemoryInfo(0u, 0u, 0u)});
+    numaConfig.m_sharedMemorySegments.push_back({"roudi_test1", "roudi_test2", mepooConfig, MemoryInfo(0u, 0u, 1u)});
+    SegmentManager<> numaSut{numaConfig, &allocator};
+
+    auto segmentOnNode0 = numaSut.getSegmentInformationForUser({"roudi_test2"}, 0u);
+    auto segmentOnNode1 = numaSut.getSegmentInformationForUser({"roudi_test2"}, 1u);
+    auto segmentWithoutNode = numaSut.getSegmentInformationForUser({"roudi_test2"});
+    auto segmentOnUnknownNode = numaSut.getSegmentInformationForUser({"roudi_test2"}, 7u);
+
+    ASSERT_THAT(segmentOnNode0.m_memoryManager, Ne(nullptr));
+    ASSERT_THAT(segmentOnNode1.m_memoryManager, Ne(nullptr));
+    EXPECT_THAT(segmentOnNode0.m_segmentID, Ne(segmentOnNode1.m_segmentID));
+    EXPECT_THAT(segmentWithoutNode.m_segmentID, Eq(segmentOnNode0.m_segmentID));
+    EXPECT_THAT(segmentOnUnknownNode.m_segmentID, Eq(segmentOnNode0.m_segmentID));
+}
+
+TEST_F(SegmentManager_test, ADD_TEST_WITH_ADDITIONAL_USER(inChunkLayoutWithDifferentReaderAndWriterGroupIsRejected))
+{
+    MePooConfig inChunkConfig = getMempoolConfig();
+    inChunkConfig.m_chunkManagementLayout = ChunkManagementLayout::IN_CHUNK;
+    SegmentConfig inChunkSegmentConfig;
+    inChunkSegmentConfig.m_sharedMemorySegments.push_back({"roudi_test1", "roudi_test2", inChunkConfig});
+
+    iox::cxx::optional<iox::Error> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandler::SetTemporaryErrorHandler(
+        [&detectedError](const iox::Error error, const std::function<void()>, const iox::ErrorLevel) {
+            detectedError.emplace(error);
+        });
+
+    SegmentManager<> inChunkSut{inChunkSegmentConfig, &allocator};
+
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_THAT(detectedError.value(),
+                Eq(iox::Error::kMEPOO__SEGMENT_IN_CHUNK_LAYOUT_REQUIRES_EQUAL_READER_AND_WRITER_GROUP));
+    EXPECT_THAT(inChunkSut.getSegmentMappings({"roudi_test2"}).size(), Eq(0u));
+}
+
+TEST_F(SegmentManager_test, ADD_TEST_WITH_ADDITIONAL_USER(inChunkLayoutWithEqualReaderAndWriterGroupIsCreated))
+{
+    MePooConfig inChunkConfig = getMempoolConfig();
+    inChunkConfig.m_chunkManagementLayout = ChunkManagementLayout::IN_CHUNK;
+    SegmentConfig inChunkSegmentConfig;
+    inChunkSegmentConfig.m_sharedMemorySegments.push_back({"roudi_test2", "roudi_test2", inChunkConfig});
+
+    SegmentManager<> inChunkSut{inChunkSegmentConfig, &allocator};
+
+    EXPECT_THAT(inChunkSut.getSegmentMappings({"roudi_test2"}).size(), Eq(1u));
+}
@@ -51,6 +51,16 @@ class StubbedBasePublisher : public iox::popo::BasePublisher<T, port_t>
     {
         return iox::popo::BasePublisher<T, port_t>::publish(std::move(sample));
     }
+    using SampleBatch_t = typename iox::popo::BasePublisher<T, port_t>::SampleBatch_t;
+    iox::cxx::expected<SampleBatch_t, iox::popo::AllocationError> loanN(const uint32_t numberOfSamples,
+                                                                         const uint32_t size) noexcept
+    {
+        return iox::popo::BasePublisher<T, port_t>::loanN(numberOfSamples, size);
+    }
+    void publishN(SampleBatch_t&& samples) noexcept
+    {
+        return iox::popo::BasePublisher<T, port_t>::publishN(std::move(samples));
+    }
     iox::cxx::optional<iox::popo::Sample<T>> loanPreviousSample() noexcept
     {
         return iox::popo::BasePublisher<T, port_t>::loanPreviousSample();
@@ -71,6 +81,10 @@ class StubbedBasePublisher : public iox::popo::BasePublisher<T, port_t>
     {
         return iox::popo::BasePublisher<T, port_t>::hasSubscribers();
     }
+    void setChunkMagazineBatchSize(const uint32_t batchSize) noexcept
+    {
+        iox::popo::BasePublisher<T, port_t>::setChunkMagazineBatchSize(batchSize);
+    }
     port_t& getMockedPort()
     {
         return iox::popo::BasePublisher<T, port_t>::m_port;
@@ -175,6 +189,68 @@ TEST_F(BasePublisherTest, PublishingSendsUnderlyingMemoryChunkOnPublisherPort)
     // ===== Cleanup ===== //
 }
 
+TEST_F(BasePublisherTest, LoanNForwardsAllocationErrorsToCaller)
+{
+    // ===== Setup ===== //
+    ON_CALL(sut.getMockedPort(), tryAllocateChunks)
+        .WillByDefault(Return(
+            ByMove(iox::cxx::error<iox::popo::AllocationError>(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS))));
+    // ===== Test ===== //
+    auto result = sut.loanN(2u, sizeof(DummyData));
+    // ===== Verify ===== //
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS, result.get_error());
+    // ===== Cleanup ===== //
+}
+
+TEST_F(BasePublisherTest, LoanNWithTooManySamplesDoesNotAllocate)
+{
+    // ===== Setup ===== //
+    EXPECT_CALL(sut.getMockedPort(), tryAllocateChunks).Times(0);
+    // ===== Test ===== //
+    auto result = sut.loanN(iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY + 1u, sizeof(DummyData));
+    // ===== Verify ===== //
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(iox::popo::AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL, result.get_error());
+    // ===== Cleanup ===== //
+}
+
+TEST_F(BasePublisherTest, LoanNAndPublishNSendAllUnderlyingMemoryChunksAtOnce)
+{
+    // ===== Setup ===== //
+    constexpr uint32_t NUMBER_OF_SAMPLES{2u};
+    iox::mepoo::ChunkHeader* chunks[NUMBER_OF_SAMPLES];
+    for (auto& chunk : chunks)
+    {
+        chunk = reinterpret_cast<iox::mepoo::ChunkHeader*>(iox::cxx::alignedAlloc(32, sizeof(iox::mepoo::ChunkHeader)));
+        new (chunk) iox::mepoo::ChunkHeader();
+    }
+    ON_CALL(sut.getMockedPort(), tryAllocateChunks)
+        .WillByDefault(Invoke([&](const uint32_t, iox::mepoo::ChunkHeader** const headers, const uint32_t count) {
+            std::copy(&chunks[0], &chunks[count], headers);
+            return iox::cxx::success<void>();
+        }));
+    EXPECT_CALL(sut.getMockedPort(), sendChunks(_, NUMBER_OF_SAMPLES))
+        .WillOnce(Invoke([&](iox::mepoo::ChunkHeader* const* const headers, const uint32_t) {
+            EXPECT_EQ(chunks[0], headers[0]);
+            EXPECT_EQ(chunks[1], headers[1]);
+        }));
+    EXPECT_CALL(sut.getMockedPort(), freeChunk).Times(0);
+    // ===== Test ===== //
+    auto result = sut.loanN(NUMBER_OF_SAMPLES, sizeof(DummyData));
+    ASSERT_FALSE(result.has_error());
+    ASSERT_EQ(NUMBER_OF_SAMPLES, result.get_value().size());
+    EXPECT_EQ(chunks[1]->payload(), result.get_value()[1].get());
+    sut.publishN(std::move(result.get_value()));
+    // ===== Verify ===== //
+    EXPECT_TRUE(result.get_value().empty());
+    // ===== Cleanup ===== //
+    for (auto& chunk : chunks)
+    {
+        iox::cxx::alignedFree(chunk);
+    }
+}
+
 TEST_F(BasePublisherTest, PreviousSampleReturnsSampleWhenPreviousChunkIsRetrievable)
 {
     // ===== Setup ===== //
@@ -238,6 +314,16 @@ TEST_F(BasePublisherTest, isOfferedDoesCheckIfUnderylingPortHasSubscribers)
     // ===== Cleanup ===== //
 }
 
+TEST_F(BasePublisherTest, SetChunkMagazineBatchSizeCallForwardedToUnderlyingPublisherPort)
+{
+    // ===== Setup ===== //
+    EXPECT_CALL(sut.getMockedPort(), setChunkMagazineBatchSize(8U)).Times(1);
+    // ===== Test ===== //
+    sut.setChunkMagazineBatchSize(8U);
+    // ===== Verify ===== //
+    // ===== Cleanup ===== //
+}
+
 TEST_F(BasePublisherTest, GetServiceDescriptionCallForwardedToUnderlyingPublisherPort)
 {
     // ===== Setup ===== //
@@ -33,12 +33,15 @@ template <typename T, typename port_t>
 class StubbedBaseSubscriber : public iox::popo::BaseSubscriber<T, port_t>
 {
   public:
+    using SampleBatch_t = typename iox::popo::BaseSubscriber<T, port_t>::SampleBatch_t;
+
     using iox::popo::BaseSubscriber<T, port_t>::getServiceDescription;
     using iox::popo::BaseSubscriber<T, port_t>::getSubscriptionState;
     using iox::popo::BaseSubscriber<T, port_t>::getUid;
     using iox::popo::BaseSubscriber<T, port_t>::hasMissedSamples;
     using iox::popo::BaseSubscriber<T, port_t>::hasNewSamples;
     using iox::popo::BaseSubscriber<T, port_t>::hasTriggered;
+    using iox::popo::BaseSubscriber<T, port_t>::releaseN;
     using iox::popo::BaseSubscriber<T, port_t>::releaseQueuedSamples;
     using iox::popo::BaseSubscriber<T, port_t>::setConditionVariable;
     using iox::popo::BaseSubscriber<T, port_t>::subscribe;
@@ -149,6 +152,48 @@ TEST_F(BaseSubscriberTest, ReceivedSamplesAreAutomaticallyDeletedWhenOutOfScope)
     // ===== Cleanup ===== //
 }
 
+TEST_F(BaseSubscriberTest, ReleaseNReleasesAllUnderlyingMemoryChunksAtOnce)
+{
+    // ===== Setup ===== //
+    constexpr uint32_t NUMBER_OF_SAMPLES{3u};
+    iox::mepoo::ChunkHeader* chunks[NUMBER_OF_SAMPLES];
+    for (auto& chunk : chunks)
+    {
+        chunk = reinterpret_cast<iox::mepoo::ChunkHeader*>(iox::cxx::alignedAlloc(32, sizeof(iox::mepoo::ChunkHeader)));
+    }
+    EXPECT_CALL(sut.getMockedPort(), tryGetChunk)
+        .WillOnce(Return(ByMove(iox::cxx::success<iox::cxx::optional<const iox::mepoo::ChunkHeader*>>(
+            const_cast<const iox::mepoo::ChunkHeader*>(chunks[0])))))
+        .WillOnce(Return(ByMove(iox::cxx::success<iox::cxx::optional<const iox::mepoo::ChunkHeader*>>(
+            const_cast<const iox::mepoo::ChunkHeader*>(chunks[1])))))
+        .WillOnce(Return(ByMove(iox::cxx::success<iox::cxx::optional<const iox::mepoo::ChunkHeader*>>(
+            const_cast<const iox::mepoo::ChunkHeader*>(chunks[2])))));
+    const iox::mepoo::ChunkHeader* releasedChunks[NUMBER_OF_SAMPLES]{nullptr, nullptr, nullptr};
+    EXPECT_CALL(sut.getMockedPort(), releaseChunks(_, NUMBER_OF_SAMPLES))
+        .WillOnce(Invoke([&](const iox::mepoo::ChunkHeader* const* headers, const uint32_t numberOfHeaders) {
+            std::copy(headers, headers + numberOfHeaders, releasedChunks);
+        }));
+    EXPECT_CALL(sut.getMockedPort(), releaseChunk).Times(0);
+    TestBaseSubscriber::SampleBatch_t samples;
+    for (uint32_t i = 0u; i < NUMBER_OF_SAMPLES; ++i)
+    {
+        samples.emplace_back(std::move(sut.take().get_value().value()));
+    }
+    // ===== Test ===== //
+    sut.releaseN(std::move(samples));
+    // ===== Verify ===== //
+    EXPECT_TRUE(samples.empty());
+    for (uint32_t i = 0u; i < NUMBER_OF_SAMPLES; ++i)
+    {
+        EXPECT_EQ(chunks[i], releasedChunks[i]);
+    }
+    // ===== Cleanup ===== //
+    for (auto& chunk : chunks)
+    {
+        iox::cxx::alignedFree(chunk);
+    }
+}
+
 TEST_F(BaseSubscriberTest, ReceiveForwardsErrorsFromUnderlyingPort)
 {
     // ===== Setup ===== //
@@ -138,6 +138,28 @@ TEST_F(ChunkReceiver_test, getAndReleaseMultipleChunks)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0u));
 }
 
+TEST_F(ChunkReceiver_test, getMultipleChunksAndReleaseThemAtOnce)
+{
+    constexpr uint32_t NUMBER_OF_CHUNKS{4u};
+    const iox::mepoo::ChunkHeader* chunks[NUMBER_OF_CHUNKS];
+
+    for (auto& chunk : chunks)
+    {
+        auto pushRet = m_chunkQueuePusher.tryPush(m_memoryManager.getChunk(sizeof(DummySample)));
+        EXPECT_FALSE(pushRet.has_error());
+
+        auto maybeChunkHeader = m_chunkReceiver.tryGet();
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        ASSERT_TRUE((*maybeChunkHeader).has_value());
+        chunk = **maybeChunkHeader;
+    }
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(NUMBER_OF_CHUNKS));
+
+    m_chunkReceiver.releaseN(chunks, NUMBER_OF_CHUNKS);
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0u));
+}
+
 TEST_F(ChunkReceiver_test, getTooMuchWithoutRelease)
 {
     // one more is OK, but we assume that one is released then (aligned with ara::com behavior)
@@ -197,6 +219,37 @@ TEST_F(ChunkReceiver_test, releaseInvalidChunk)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1u));
 }
 
+TEST_F(ChunkReceiver_test, releaseNWithInvalidChunkReleasesTheValidOnesAndCallsErrorHandler)
+{
+    constexpr uint32_t NUMBER_OF_CHUNKS{3u};
+    const iox::mepoo::ChunkHeader* chunks[NUMBER_OF_CHUNKS];
+    auto myCrazyChunk = std::make_shared<iox::mepoo::ChunkHeader>();
+    chunks[1] = myCrazyChunk.get();
+
+    for (auto index : {0u, 2u})
+    {
+        auto pushRet = m_chunkQueuePusher.tryPush(m_memoryManager.getChunk(sizeof(DummySample)));
+        EXPECT_FALSE(pushRet.has_error());
+
+        auto maybeChunkHeader = m_chunkReceiver.tryGet();
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        ASSERT_TRUE((*maybeChunkHeader).has_value());
+        chunks[index] = **maybeChunkHeader;
+    }
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(2u));
+
+    auto errorHandlerCalled{false};
+    auto errorHandlerGuard = iox::ErrorHandler::SetTemporaryErrorHandler(
+        [&errorHandlerCalled](const iox::Error, const std::function<void()>, const iox::ErrorLevel) {
+            errorHandlerCalled = true;
+        });
+
+    m_chunkReceiver.releaseN(chunks, NUMBER_OF_CHUNKS);
+
+    EXPECT_TRUE(errorHandlerCalled);
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0u));
+}
+
 TEST_F(ChunkReceiver_test, Cleanup)
 {
     for (size_t i = 0; i < iox::MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY + iox::MAX_SUBSCRIBER_QUEUE_CAPACITY; i++)
@@ -43,8 +43,8 @@ class ChunkSender_test : public Test
   protected:
     ChunkSender_test()
     {
-        m_mempoolconf.addMemPool({SMALL_CHUNK, NUM_CHUNKS_IN_POOL});
-        m_mempoolconf.addMemPool({BIG_CHUNK, NUM_CHUNKS_IN_POOL});
+        m_mempoolconf.addMemPool({SMALL_CHUNK, NUM_CHUNKS_IN_POOL, NUM_CHUNK_MAGAZINES});
+        m_mempoolconf.addMemPool({BIG_CHUNK, NUM_CHUNKS_IN_POOL, NUM_CHUNK_MAGAZINES});
         m_memoryManager.configureMemoryManager(m_mempoolconf, &m_memoryAllocator, &m_memoryAllocator);
     }
 
@@ -63,6 +63,7 @@ class ChunkSender_test : public Test
     static constexpr size_t MEMORY_SIZE = 1024 * 1024;
     uint8_t m_memory[MEMORY_SIZE];
     static constexpr uint32_t NUM_CHUNKS_IN_POOL = 20;
+    static constexpr uint32_t NUM_CHUNK_MAGAZINES = 2;
     static constexpr uint32_t SMALL_CHUNK = 128;
     static constexpr uint32_t BIG_CHUNK = 256;
     static constexpr uint64_t HISTORY_CAPACITY = 4;
@@ -600,3 +601,214 @@ TEST_F(ChunkSender_test, Cleanup)
 
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0u));
 }
+
+TEST_F(ChunkSender_test, allocateWithChunkMagazineAccountsOnlyHandedOutChunksAsUsed)
+{
+    // the batch is limited to an eighth of the NUM_CHUNKS_IN_POOL chunks of the mempool
+    constexpr uint32_t BATCH_SIZE{2u};
+    m_chunkSender.setChunkMagazineBatchSize(BATCH_SIZE);
+
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(sizeof(DummySample), iox::UniquePortId());
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1u));
+    EXPECT_THAT(m_chunkSenderData.m_chunkMagazines.m_payload[0].size(), Eq(BATCH_SIZE - 1u));
+}
+
+TEST_F(ChunkSender_test, allocateWithChunkMagazineKeepsStashesOfDifferentMemPools)
+{
+    m_chunkSender.setChunkMagazineBatchSize(2u);
+
+    auto maybeSmallChunkHeader = m_chunkSender.tryAllocate(sizeof(DummySample), iox::UniquePortId());
+    ASSERT_FALSE(maybeSmallChunkHeader.has_error());
+    auto maybeBigChunkHeader = m_chunkSender.tryAllocate(BIG_CHUNK, iox::UniquePortId());
+    ASSERT_FALSE(maybeBigChunkHeader.has_error());
+
+    EXPECT_THAT(m_chunkSenderData.m_chunkMagazines.m_payload[0].size(), Eq(1u));
+    EXPECT_THAT(m_chunkSenderData.m_chunkMagazines.m_payload[1].size(), Eq(1u));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_stashedChunks, Eq(1u));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(1).m_stashedChunks, Eq(1u));
+}
+
+TEST_F(ChunkSender_test, allocateWithoutChunkMagazineReclaimsStashedChunksOfOtherSender)
+{
+    m_chunkSenderWithHistory.setChunkMagazineBatchSize(2u);
+    auto maybeChunkHeader = m_chunkSenderWithHistory.tryAllocate(sizeof(DummySample), iox::UniquePortId());
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    ASSERT_THAT(m_chunkSenderDataWithHistory.m_chunkMagazines.m_payload[0].size(), Eq(1u));
+
+    // all chunks except the one handed out to m_chunkSenderWithHistory are available
+    std::vector<iox::mepoo::SharedChunk> chunks;
+    for (size_t i = 0; i < NUM_CHUNKS_IN_POOL - 1u; i++)
+    {
+        chunks.emplace_back(m_memoryManager.getChunk(sizeof(DummySample)));
+        EXPECT_TRUE(chunks.back());
+    }
+
+    EXPECT_THAT(m_chunkSenderDataWithHistory.m_chunkMagazines.m_payload[0].size(), Eq(0u));
+    m_chunkSenderWithHistory.release(*maybeChunkHeader);
+}
+
+TEST_F(ChunkSender_test, disablingChunkMagazineReturnsStashedChunks)
+{
+    m_chunkSender.setChunkMagazineBatchSize(8u);
+
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(sizeof(DummySample), iox::UniquePortId());
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    m_chunkSender.setChunkMagazineBatchSize(0u);
+
+    EXPECT_THAT(m_chunkSenderData.m_chunkMagazines.m_payload[0].size(), Eq(0u));
+    EXPECT_THAT(m_chunkSenderData.m_chunkMagazines.m_chunkManagement.size(), Eq(0u));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1u));
+
+    m_chunkSender.release(*maybeChunkHeader);
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0u));
+}
+
+TEST_F(ChunkSender_test, CleanupFlushesChunkMagazines)
+{
+    m_chunkSenderWithHistory.setChunkMagazineBatchSize(8u);
+
+    for (size_t i = 0; i < HISTORY_CAPACITY; i++)
+    {
+        auto maybeChunkHeader = m_chunkSenderWithHistory.tryAllocate(SMALL_CHUNK, iox::UniquePortId());
+        EXPECT_FALSE(maybeChunkHeader.has_error());
+        m_chunkSenderWithHistory.send(*maybeChunkHeader);
+    }
+
+    m_chunkSenderWithHistory.releaseAll();
+
+    EXPECT_THAT(m_chunkSenderDataWithHistory.m_chunkMagazines.m_payload[0].size(), Eq(0u));
+    EXPECT_THAT(m_chunkSenderDataWithHistory.m_chunkMagazines.m_chunkManagement.size(), Eq(0u));
+
+    // all chunks are back in the free list and can be acquired by someone else
+    std::vector<iox::mepoo::SharedChunk> chunks;
+    for (size_t i = 0; i < NUM_CHUNKS_IN_POOL; i++)
+    {
+        chunks.emplace_back(m_memoryManager.getChunk(SMALL_CHUNK));
+        EXPECT_TRUE(chunks.back());
+    }
+}
+
+TEST_F(ChunkSender_test, allocateN_AllChunksAreAllocatedWithOriginIdSet)
+{
+    constexpr uint32_t NUMBER_OF_CHUNKS{iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY};
+    iox::mepoo::ChunkHeader* chunkHeaders[NUMBER_OF_CHUNKS];
+    iox::UniquePortId uniqueId;
+
+    auto result = m_chunkSender.tryAllocateN(sizeof(DummySample), uniqueId, chunkHeaders, NUMBER_OF_CHUNKS);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(NUMBER_OF_CHUNKS));
+    for (uint32_t i = 0; i < NUMBER_OF_CHUNKS; i++)
+    {
+        EXPECT_THAT(chunkHeaders[i]->m_originId, Eq(uniqueId));
+        m_chunkSender.release(chunkHeaders[i]);
+    }
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0u));
+}
+
+TEST_F(ChunkSender_test, allocateN_MoreThanAllowedInParallelAllocatesNothing)
+{
+    constexpr uint32_t NUMBER_OF_CHUNKS{iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY + 1u};
+    iox::mepoo::ChunkHeader* chunkHeaders[NUMBER_OF_CHUNKS];
+
+    auto result =
+        m_chunkSender.tryAllocateN(sizeof(DummySample), iox::UniquePortId(), chunkHeaders, NUMBER_OF_CHUNKS);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(iox::popo::AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0u));
+}
+
+TEST_F(ChunkSender_test, allocateN_ExceedingTheUsedChunkListAllocatesNothing)
+{
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(sizeof(DummySample), iox::UniquePortId());
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+
+    constexpr uint32_t NUMBER_OF_CHUNKS{iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY};
+    iox::mepoo::ChunkHeader* chunkHeaders[NUMBER_OF_CHUNKS];
+    auto result =
+        m_chunkSender.tryAllocateN(sizeof(DummySample), iox::UniquePortId(), chunkHeaders, NUMBER_OF_CHUNKS);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(iox::popo::AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1u));
+
+    // the used chunk list is still intact
+    m_chunkSender.release(*maybeChunkHeader);
+    result = m_chunkSender.tryAllocateN(sizeof(DummySample), iox::UniquePortId(), chunkHeaders, NUMBER_OF_CHUNKS);
+    EXPECT_FALSE(result.has_error());
+}
+
+TEST_F(ChunkSender_test, allocateN_RunningOutOfChunksAllocatesNothing)
+{
+    // leave fewer chunks in the mempool than requested
+    constexpr uint32_t NUMBER_OF_CHUNKS{2u};
+    std::vector<iox::mepoo::SharedChunk> chunks;
+    for (size_t i = 0; i < NUM_CHUNKS_IN_POOL - 1u; i++)
+    {
+        chunks.emplace_back(m_memoryManager.getChunk(sizeof(DummySample)));
+        ASSERT_TRUE(chunks.back());
+    }
+
+    iox::mepoo::ChunkHeader* chunkHeaders[NUMBER_OF_CHUNKS];
+    auto result =
+        m_chunkSender.tryAllocateN(sizeof(DummySample), iox::UniquePortId(), chunkHeaders, NUMBER_OF_CHUNKS);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(NUM_CHUNKS_IN_POOL - 1u));
+}
+
+TEST_F(ChunkSender_test, sendN_DeliversAllChunksInOrderWithSequenceNumbers)
+{
+    m_chunkSenderWithHistory.tryAddQueue(&m_chunkQueueData);
+    constexpr uint32_t NUMBER_OF_CHUNKS{iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY};
+    iox::mepoo::ChunkHeader* chunkHeaders[NUMBER_OF_CHUNKS];
+    ASSERT_FALSE(
+        m_chunkSenderWithHistory.tryAllocateN(sizeof(DummySample), iox::UniquePortId(), chunkHeaders, NUMBER_OF_CHUNKS)
+            .has_error());
+    for (uint32_t i = 0; i < NUMBER_OF_CHUNKS; i++)
+    {
+        new (chunkHeaders[i]->payload()) DummySample{i};
+    }
+
+    m_chunkSenderWithHistory.sendN(chunkHeaders, NUMBER_OF_CHUNKS);
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    for (uint32_t i = 0; i < NUMBER_OF_CHUNKS; i++)
+    {
+        auto popRet = myQueue.tryPop();
+        ASSERT_TRUE(popRet.has_value());
+        EXPECT_THAT(reinterpret_cast<DummySample*>(popRet->getPayload())->dummy, Eq(i));
+        EXPECT_THAT(popRet->getChunkHeader()->m_info.m_sequenceNumber, Eq(i));
+    }
+    EXPECT_TRUE(myQueue.empty());
+    EXPECT_THAT(m_chunkSenderWithHistory.getHistorySize(), Eq(HISTORY_CAPACITY));
+
+    auto maybeLastChunk = m_chunkSenderWithHistory.tryGetPreviousChunk();
+    ASSERT_TRUE(maybeLastChunk.has_value());
+    EXPECT_THAT(*maybeLastChunk, Eq(chunkHeaders[NUMBER_OF_CHUNKS - 1u]));
+}
+
+TEST_F(ChunkSender_test, sendNWithInvalidChunkDeliversTheValidOnesAndCallsErrorHandler)
+{
+    m_chunkSender.tryAddQueue(&m_chunkQueueData);
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(sizeof(DummySample), iox::UniquePortId());
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    iox::mepoo::ChunkHeader invalidChunkHeader;
+    iox::mepoo::ChunkHeader* chunkHeaders[]{*maybeChunkHeader, &invalidChunkHeader};
+
+    auto errorHandlerCalled{false};
+    auto errorHandlerGuard = iox::ErrorHandler::SetTemporaryErrorHandler(
+        [&errorHandlerCalled](const iox::Error, const std::function<void()>, const iox::ErrorLevel) {
+            errorHandlerCalled = true;
+        });
+
+    m_chunkSender.sendN(chunkHeaders, 2u);
+
+    EXPECT_TRUE(errorHandlerCalled);
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    EXPECT_THAT(myQueue.size(), Eq(1u));
+}
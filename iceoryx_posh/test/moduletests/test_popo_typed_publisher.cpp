@@ -68,6 +68,20 @@ TEST_F(TypedPublisherTest, LoansSamplesLargeEnoughForTheType)
     iox::cxx::alignedFree(chunk);
 }
 
+TEST_F(TypedPublisherTest, LoanNLoansSamplesLargeEnoughForTheType)
+{
+    // ===== Setup ===== //
+    EXPECT_CALL(sut, loanN(3u, sizeof(DummyData)))
+        .WillOnce(Return(
+            ByMove(iox::cxx::error<iox::popo::AllocationError>(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS))));
+    // ===== Test ===== //
+    auto result = sut.loanN(3u);
+    // ===== Verify ===== //
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS, result.get_error());
+    // ===== Cleanup ===== //
+}
+
 TEST_F(TypedPublisherTest, CanLoanSamplesAndPublishTheResultOfALambdaWithAdditionalArguments)
 {
     // ===== Setup ===== //
@@ -0,0 +1,43 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "test.hpp"
+
+using namespace ::testing;
+
+using iox::mepoo::MemoryInfo;
+using iox::runtime::PortConfigInfo;
+
+TEST(PortConfigInfo_test, SerializationRoundTripKeepsAllMembers)
+{
+    PortConfigInfo sut(PortConfigInfo(11u, 22u, 33u, 1u));
+    PortConfigInfo deserialized{static_cast<iox::cxx::Serialization>(sut)};
+
+    EXPECT_THAT(deserialized.portType, Eq(11u));
+    EXPECT_THAT(deserialized.memoryInfo.deviceId, Eq(22u));
+    EXPECT_THAT(deserialized.memoryInfo.memoryType, Eq(33u));
+    EXPECT_THAT(deserialized.memoryInfo.numaNode, Eq(1u));
+}
+
+TEST(PortConfigInfo_test, SerializationWithoutNumaNodeUsesAnyNumaNode)
+{
+    auto serialization = iox::cxx::Serialization::create(11u, 22u, 33u);
+    PortConfigInfo sut{serialization};
+
+    EXPECT_THAT(sut.portType, Eq(11u));
+    EXPECT_THAT(sut.memoryInfo.deviceId, Eq(22u));
+    EXPECT_THAT(sut.memoryInfo.memoryType, Eq(33u));
+    EXPECT_THAT(sut.memoryInfo.numaNode, Eq(MemoryInfo::ANY_NUMA_NODE));
+}
@@ -0,0 +1,127 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/roudi/roudi_config_toml_file_provider.hpp"
+
+#include "test.hpp"
+
+#include <cstdio>
+#include <fstream>
+
+using namespace ::testing;
+
+class CmdLineParserConfigFileOptionStub : public iox::config::CmdLineParserConfigFileOption
+{
+  public:
+    void setConfigFilePath(const char* configFilePath)
+    {
+        m_customConfigFilePath = iox::ConfigFilePathString_t(iox::cxx::TruncateToCapacity, configFilePath);
+    }
+};
+
+class TomlRouDiConfigFileProvider_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        m_cmdLineParser.setConfigFilePath(CONFIG_FILE_PATH);
+    }
+
+    void TearDown() override
+    {
+        std::remove(CONFIG_FILE_PATH);
+    }
+
+    void writeConfigFile(const char* content)
+    {
+        std::ofstream configFile(CONFIG_FILE_PATH, std::ios::trunc);
+        configFile << content;
+    }
+
+    static constexpr const char* CONFIG_FILE_PATH = "/tmp/test_roudi_config_toml_file_provider.toml";
+    CmdLineParserConfigFileOptionStub m_cmdLineParser;
+};
+
+constexpr const char* TomlRouDiConfigFileProvider_test::CONFIG_FILE_PATH;
+
+TEST_F(TomlRouDiConfigFileProvider_test, ChunkManagementLayoutIsSeparatePoolByDefault)
+{
+    writeConfigFile("[general]\n"
+                    "version = 1\n"
+                    "[[segment]]\n"
+                    "[[segment.mempool]]\n"
+                    "size = 128\n"
+                    "count = 10\n");
+    iox::config::TomlRouDiConfigFileProvider sut(m_cmdLineParser);
+
+    auto result = sut.parse();
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(result.get_value().m_sharedMemorySegments.front().m_mempoolConfig.m_chunkManagementLayout,
+                Eq(iox::mepoo::ChunkManagementLayout::SEPARATE_POOL));
+}
+
+TEST_F(TomlRouDiConfigFileProvider_test, ChunkManagementLayoutInChunkIsParsed)
+{
+    writeConfigFile("[general]\n"
+                    "version = 1\n"
+                    "[[segment]]\n"
+                    "chunk-management = \"in-chunk\"\n"
+                    "[[segment.mempool]]\n"
+                    "size = 128\n"
+                    "count = 10\n");
+    iox::config::TomlRouDiConfigFileProvider sut(m_cmdLineParser);
+
+    auto result = sut.parse();
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(result.get_value().m_sharedMemorySegments.front().m_mempoolConfig.m_chunkManagementLayout,
+                Eq(iox::mepoo::ChunkManagementLayout::IN_CHUNK));
+}
+
+TEST_F(TomlRouDiConfigFileProvider_test, ChunkManagementLayoutInChunkWithDifferentReaderAndWriterFails)
+{
+    writeConfigFile("[general]\n"
+                    "version = 1\n"
+                    "[[segment]]\n"
+                    "reader = \"foo\"\n"
+                    "writer = \"bar\"\n"
+                    "chunk-management = \"in-chunk\"\n"
+                    "[[segment.mempool]]\n"
+                    "size = 128\n"
+                    "count = 10\n");
+    iox::config::TomlRouDiConfigFileProvider sut(m_cmdLineParser);
+
+    auto result = sut.parse();
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(iox::roudi::RouDiConfigFileParseError::INVALID_CHUNK_MANAGEMENT_LAYOUT));
+}
+
+TEST_F(TomlRouDiConfigFileProvider_test, UnknownChunkManagementLayoutFails)
+{
+    writeConfigFile("[general]\n"
+                    "version = 1\n"
+                    "[[segment]]\n"
+                    "chunk-management = \"somewhere\"\n"
+                    "[[segment.mempool]]\n"
+                    "size = 128\n"
+                    "count = 10\n");
+    iox::config::TomlRouDiConfigFileProvider sut(m_cmdLineParser);
+
+    auto result = sut.parse();
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(iox::roudi::RouDiConfigFileParseError::INVALID_CHUNK_MANAGEMENT_LAYOUT));
+}
@@ -181,6 +181,38 @@ TEST_F(MemPoolIntrospection_test, send_noSubscribers)
     EXPECT_THAT(mock->reserveChunk, Eq(0));
 }
 
+TEST_F(MemPoolIntrospection_test, copyMemPoolInfoSubtractsTheChunkHeaderFromThePayloadSize)
+{
+    MemPoolIntrospection m_introspection(
+        m_rouDiInternalMemoryManager_mock, m_segmentManager_mock, std::move(m_senderPortImpl_mock));
+    MemPoolInfo memPoolInfo(0, 0, 0, 256);
+    EXPECT_CALL(m_rouDiInternalMemoryManager_mock, getMemPoolInfo(_)).WillRepeatedly(Return(memPoolInfo));
+
+    MemPoolInfoContainer memPoolInfoContainer;
+    m_introspection.copyMemPoolInfo(m_rouDiInternalMemoryManager_mock, memPoolInfoContainer);
+
+    ASSERT_THAT(memPoolInfoContainer.size(), Gt(0u));
+    EXPECT_THAT(memPoolInfoContainer[0].m_payloadSize,
+                Eq(256u - static_cast<uint32_t>(sizeof(iox::mepoo::ChunkHeader))));
+}
+
+TEST_F(MemPoolIntrospection_test, copyMemPoolInfoWithInChunkLayoutSubtractsTheChunkManagementFromThePayloadSize)
+{
+    MemPoolIntrospection m_introspection(
+        m_rouDiInternalMemoryManager_mock, m_segmentManager_mock, std::move(m_senderPortImpl_mock));
+    MemPoolInfo memPoolInfo(0, 0, 0, 256);
+    EXPECT_CALL(m_rouDiInternalMemoryManager_mock, getMemPoolInfo(_)).WillRepeatedly(Return(memPoolInfo));
+    m_rouDiInternalMemoryManager_mock.chunkManagementLayout = iox::mepoo::ChunkManagementLayout::IN_CHUNK;
+
+    MemPoolInfoContainer memPoolInfoContainer;
+    m_introspection.copyMemPoolInfo(m_rouDiInternalMemoryManager_mock, memPoolInfoContainer);
+
+    ASSERT_THAT(memPoolInfoContainer.size(), Gt(0u));
+    EXPECT_THAT(memPoolInfoContainer[0].m_payloadSize,
+                Eq(256u - static_cast<uint32_t>(sizeof(iox::mepoo::ChunkHeader))
+                   - static_cast<uint32_t>(sizeof(iox::mepoo::ChunkManagement))));
+}
+
 /// @todo test with multiple segments and also test the mempool info from RouDiInternalMemoryManager
 /// @todo This test is not very useful as it is highly implementation-dependent and fails if the implementation changes.
 /// Should be realized as an integration test with a roudi environment and less mocking classes instead.
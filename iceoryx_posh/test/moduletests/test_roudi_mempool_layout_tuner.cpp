@@ -0,0 +1,131 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/roudi/mempool_layout_tuner.hpp"
+
+#include "test.hpp"
+
+#include <cstring>
+#include <sstream>
+
+using namespace ::testing;
+
+using namespace iox::roudi;
+
+class MemPoolLayoutTuner_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        strcpy(recording.m_readerGroupName, "reader");
+        strcpy(recording.m_writerGroupName, "writer");
+        recording.m_id = 1u;
+    }
+
+    void TearDown() override
+    {
+    }
+
+    void addMemPool(const uint32_t payloadSize,
+                    const uint32_t numChunks,
+                    const uint32_t minFreeChunks,
+                    const uint32_t maxRequestedPayloadSize = 0u)
+    {
+        MemPoolInfo info;
+        info.m_payloadSize = payloadSize;
+        info.m_chunkSize = payloadSize + 64u;
+        info.m_numChunks = numChunks;
+        info.m_minFreeChunks = minFreeChunks;
+        info.m_maxRequestedPayloadSize = maxRequestedPayloadSize;
+        recording.m_mempoolInfo.emplace_back(info);
+    }
+
+    MemPoolIntrospectionInfo recording{};
+};
+
+TEST_F(MemPoolLayoutTuner_test, UnusedMemPoolsAreDropped)
+{
+    addMemPool(128u, 100u, 100u);
+    addMemPool(1024u, 100u, 90u);
+
+    auto suggestion = suggestMePooConfig(recording, 0u);
+
+    ASSERT_THAT(suggestion.m_mempoolConfig.size(), Eq(1u));
+    EXPECT_THAT(suggestion.m_mempoolConfig[0].m_size, Eq(1024u));
+    EXPECT_THAT(suggestion.m_mempoolConfig[0].m_chunkCount, Eq(10u));
+}
+
+TEST_F(MemPoolLayoutTuner_test, HeadroomIsAddedToThePeakUsageAndRoundedUp)
+{
+    addMemPool(128u, 100u, 90u);
+    addMemPool(1024u, 100u, 99u);
+
+    auto suggestion = suggestMePooConfig(recording, 25u);
+
+    ASSERT_THAT(suggestion.m_mempoolConfig.size(), Eq(2u));
+    EXPECT_THAT(suggestion.m_mempoolConfig[0].m_chunkCount, Eq(13u));
+    EXPECT_THAT(suggestion.m_mempoolConfig[1].m_chunkCount, Eq(2u));
+}
+
+TEST_F(MemPoolLayoutTuner_test, PayloadSizesAreKeptWithoutAllocationProfile)
+{
+    addMemPool(1024u, 100u, 90u, 100u);
+
+    auto suggestion = suggestMePooConfig(recording, 0u);
+
+    ASSERT_THAT(suggestion.m_mempoolConfig.size(), Eq(1u));
+    EXPECT_THAT(suggestion.m_mempoolConfig[0].m_size, Eq(1024u));
+}
+
+TEST_F(MemPoolLayoutTuner_test, PayloadSizesAreShrunkToTheAlignedLargestServedPayloadSize)
+{
+    recording.m_isAllocationProfileRecorded = true;
+    addMemPool(128u, 100u, 90u, 128u);
+    addMemPool(1024u, 100u, 90u, 300u);
+
+    auto suggestion = suggestMePooConfig(recording, 0u);
+
+    ASSERT_THAT(suggestion.m_mempoolConfig.size(), Eq(2u));
+    EXPECT_THAT(suggestion.m_mempoolConfig[0].m_size, Eq(128u));
+    EXPECT_THAT(suggestion.m_mempoolConfig[1].m_size, Eq(320u));
+}
+
+TEST_F(MemPoolLayoutTuner_test, MemPoolWhichOnlyServedFallbackRequestsIsMergedIntoThePreviousMemPool)
+{
+    recording.m_isAllocationProfileRecorded = true;
+    addMemPool(128u, 10u, 0u, 100u);
+    addMemPool(1024u, 100u, 95u, 90u);
+
+    auto suggestion = suggestMePooConfig(recording, 0u);
+
+    ASSERT_THAT(suggestion.m_mempoolConfig.size(), Eq(1u));
+    EXPECT_THAT(suggestion.m_mempoolConfig[0].m_size, Eq(128u));
+    EXPECT_THAT(suggestion.m_mempoolConfig[0].m_chunkCount, Eq(15u));
+}
+
+TEST_F(MemPoolLayoutTuner_test, LayoutIsWrittenAsSegmentOfTheConfigFile)
+{
+    recording.m_isAllocationProfileRecorded = true;
+    recording.m_requestedPayloadSizes[7] = 42u;
+    addMemPool(128u, 10u, 0u, 100u);
+
+    std::stringstream stream;
+    writeMemPoolLayout(stream, recording, suggestMePooConfig(recording, 0u));
+    const auto layout = stream.str();
+
+    EXPECT_THAT(layout, HasSubstr("[[segment]]\nreader = \"reader\"\nwriter = \"writer\"\n"));
+    EXPECT_THAT(layout, HasSubstr("[[segment.mempool]]\nsize = 128\ncount = 10\n"));
+    EXPECT_THAT(layout, HasSubstr("#   <= 128: 42\n"));
+    EXPECT_THAT(layout, HasSubstr("was exhausted during the recording"));
+}
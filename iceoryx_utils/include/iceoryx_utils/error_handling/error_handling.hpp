@@ -86,12 +86,14 @@ namespace iox
     error(MEPOO__MEMPOOL_GETCHUNK_CHUNK_IS_TOO_LARGE) \
     error(MEPOO__MEMPOOL_CHUNKSIZE_MUST_BE_LARGER_THAN_SHARED_MEMORY_ALIGNMENT_AND_MULTIPLE_OF_ALIGNMENT) \
     error(MEPOO__MEMPOOL_ADDMEMPOOL_AFTER_GENERATECHUNKMANAGEMENTPOOL) \
+    error(MEPOO__MEMPOOL_CHUNKSIZE_EXCEEDS_MAXIMUM) \
     error(MEPOO__TYPED_MEMPOOL_HAS_INCONSISTENT_STATE) \
     error(MEPOO__TYPED_MEMPOOL_MANAGEMENT_SEGMENT_IS_BROKEN) \
     error(MEPOO__SEGMENT_CONTAINER_OVERFLOW) \
     error(MEPOO__USER_WITH_MORE_THAN_ONE_WRITE_SEGMENT) \
     error(MEPOO__SEGMENT_COULD_NOT_APPLY_POSIX_RIGHTS_TO_SHARED_MEMORY) \
     error(MEPOO__SEGMENT_UNABLE_TO_CREATE_SHARED_MEMORY_OBJECT) \
+    error(MEPOO__SEGMENT_IN_CHUNK_LAYOUT_REQUIRES_EQUAL_READER_AND_WRITER_GROUP) \
     error(MEPOO__INTROSPECTION_CONTAINER_FULL) \
     error(PORT_POOL__SENDERLIST_OVERFLOW) /* @deprecated #25 */ \
     error(PORT_POOL__RECEIVERLIST_OVERFLOW) /* @deprecated #25 */ \
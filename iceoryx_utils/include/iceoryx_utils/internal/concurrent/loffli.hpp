@@ -82,6 +82,18 @@ class LoFFLi
     /// @return true if index is valid or not yet pushed, false otherwise
     bool push(const uint32_t index);
 
+    /// Pop multiple values from the free-list with a single compare-and-swap on the head
+    /// @param [out] indices memory for at least maxNumberOfIndices elements
+    /// @param [in] maxNumberOfIndices is the maximum number of elements to pop
+    /// @return the number of valid indices, less than maxNumberOfIndices if the free-list runs empty
+    uint32_t pop(uint32_t* const indices, const uint32_t maxNumberOfIndices);
+
+    /// Push multiple previously poped elements with a single compare-and-swap on the head
+    /// @param [in] indices to previously poped elements
+    /// @param [in] numberOfIndices is the number of elements in indices
+    /// @return true if all indices are valid and not yet pushed, false otherwise; in this case nothing is pushed
+    bool push(const uint32_t* const indices, const uint32_t numberOfIndices);
+
     /// Calculates the required memory size for a free-list
     /// @param [in] f_size is the number of elements of the free-list
     /// @return the required memory size for a free-list with f_size elements
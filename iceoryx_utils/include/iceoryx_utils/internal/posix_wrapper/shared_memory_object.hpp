@@ -37,7 +37,10 @@ class SharedMemoryObject
                                                     const OwnerShip f_ownerShip,
                                                     const void* f_baseAddressHint,
                                                     const mode_t f_permissions = S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP
-                                                                                 | S_IROTH | S_IWOTH);
+                                                                                 | S_IROTH | S_IWOTH,
+                                                    const PageType f_pageType = PageType::normal,
+                                                    const PageFaultPolicy f_pageFaultPolicy = PageFaultPolicy::onDemand,
+                                                    const uint32_t f_numaNode = MemoryMap::ANY_NUMA_NODE);
     SharedMemoryObject(const SharedMemoryObject&) = delete;
     SharedMemoryObject& operator=(const SharedMemoryObject&) = delete;
     SharedMemoryObject(SharedMemoryObject&&) = default;
@@ -61,7 +64,10 @@ class SharedMemoryObject
                        const AccessMode f_accessMode,
                        const OwnerShip f_ownerShip,
                        const void* f_baseAddressHint,
-                       const mode_t f_permissions);
+                       const mode_t f_permissions,
+                       const PageType f_pageType,
+                       const PageFaultPolicy f_pageFaultPolicy,
+                       const uint32_t f_numaNode);
 
     bool isInitialized() const;
 
@@ -19,6 +19,7 @@
 #include "iceoryx_utils/platform/mman.hpp"
 
 #include <cstdint>
+#include <limits>
 
 namespace iox
 {
@@ -29,6 +30,11 @@ class SharedMemoryObject;
 class MemoryMap
 {
   public:
+    /// size of a transparent huge page on the common platforms
+    static constexpr uint64_t HUGE_PAGE_SIZE{2u * 1024u * 1024u};
+    /// the memory is not bound to a NUMA node and is placed by the default policy of the system
+    static constexpr uint32_t ANY_NUMA_NODE{std::numeric_limits<uint32_t>::max()};
+
     cxx::optional<MemoryMap> static create(const void* f_baseAddressHint,
                                            const uint64_t f_length,
                                            const int32_t f_fileDescriptor,
@@ -36,6 +42,12 @@ class MemoryMap
                                            const int32_t f_flags = MAP_SHARED,
                                            const off_t f_offset = 0);
 
+    /// @brief returns an address which is aligned to HUGE_PAGE_SIZE and where currently f_length bytes are unmapped;
+    /// a mapping at this address can be backed by huge pages from its first to its last byte
+    /// @param[in] f_length the size of the mapping
+    /// @return the address which can be used as base address hint or nullptr if no address could be found
+    static void* hugePageAlignedAddressHint(const uint64_t f_length);
+
     MemoryMap(const MemoryMap&) = delete;
     MemoryMap& operator=(const MemoryMap&) = delete;
     MemoryMap(MemoryMap&& rhs);
@@ -44,6 +56,32 @@ class MemoryMap
     ~MemoryMap();
     void* getBaseAddress() const;
 
+    /// @brief advises the kernel to back the mapping with transparent huge pages; this has to be done before the
+    /// memory is accessed for the first time
+    /// @return true if the advice was accepted, false if the platform does not support transparent huge pages
+    /// @note the kernel accepts the advice for shared memory even if it does not use huge pages for it, see
+    /// hugePagesAvailableForSharedMemory
+    bool adviseHugePages();
+
+    /// @brief binds the memory to a NUMA node; this has to be done before the memory is accessed for the first time.
+    /// For shared memory the binding applies to every process which maps the memory.
+    /// @param[in] f_numaNode the node on which the pages shall be allocated
+    /// @return true if the memory was bound, false if the node does not exist or the platform does not support NUMA
+    bool bindToNumaNode(const uint32_t f_numaNode);
+
+    /// @brief maps all pages of the memory into the address space of the process by touching them, this way the
+    /// first access in the application does not page fault
+    /// @return true if the pages could be touched, false if the page size is unknown
+    bool prefault();
+
+    /// @brief locks all pages of the memory into RAM, they are prefaulted by this call and cannot be swapped out
+    /// @return true if the memory could be locked, false otherwise, e.g. if RLIMIT_MEMLOCK is exceeded
+    bool lock();
+
+    /// @brief checks whether the memory was locked into RAM
+    /// @return true if the memory is locked, false otherwise
+    bool isLocked() const;
+
     friend class posix::SharedMemoryObject;
     friend class cxx::optional<MemoryMap>;
 
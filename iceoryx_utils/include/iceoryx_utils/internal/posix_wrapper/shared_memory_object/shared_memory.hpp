@@ -34,6 +34,23 @@ enum class OwnerShip
     mine,
     openExisting
 };
+enum class PageType
+{
+    /// the memory is backed by pages of the default page size
+    normal,
+    /// the memory is advised to be backed by transparent huge pages, if the system does not provide them the memory
+    /// is backed by pages of the default page size
+    huge
+};
+enum class PageFaultPolicy
+{
+    /// the pages are mapped on the first access
+    onDemand,
+    /// all pages are mapped when the memory is created or opened, this way the first access does not page fault
+    prefault,
+    /// like prefault, additionally the pages are locked into RAM and cannot be swapped out
+    lock
+};
 
 class SharedMemory
 {
@@ -27,6 +27,16 @@ constexpr uint64_t MaxPageSize = 1024u * 512u;
 
 cxx::optional<uint64_t> pageSize();
 
+/// @brief returns the NUMA node of the CPU on which the calling thread currently runs
+/// @return the NUMA node or cxx::nullopt_t if the platform does not provide this information
+cxx::optional<uint32_t> numaNodeOfCurrentThread();
+
+/// @brief checks whether the kernel backs POSIX shared memory with transparent huge pages when they are advised.
+/// The shared memory objects live in the tmpfs /dev/shm whose "huge" mount option decides this, unless
+/// /sys/kernel/mm/transparent_hugepage/shmem_enabled overrides it with "force" or "deny".
+/// @return true if huge pages are used for advised POSIX shared memory, false otherwise
+bool hugePagesAvailableForSharedMemory();
+
 } // namespace posix
 } // namespace iox
 
@@ -59,6 +59,17 @@ inline int munmap(void* addr, size_t length)
     return -1;
 }
 
+inline int mlock(const void* addr, size_t len)
+{
+    if (VirtualLock(const_cast<void*>(addr), len))
+    {
+        return 0;
+    }
+
+    PrintLastErrorToConsole();
+    return -1;
+}
+
 inline int shm_open(const char* name, int oflag, mode_t mode)
 {
     static constexpr DWORD MAXIMUM_SIZE_HIGH = 0;
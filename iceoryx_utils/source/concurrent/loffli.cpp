@@ -98,5 +98,101 @@ bool LoFFLi::push(const uint32_t index)
     return true;
 }
 
+uint32_t LoFFLi::pop(uint32_t* const indices, const uint32_t maxNumberOfIndices)
+{
+    if (maxNumberOfIndices == 0u)
+    {
+        return 0u;
+    }
+
+    Node oldHead = m_head.load(std::memory_order_acquire);
+    Node newHead = oldHead;
+    uint32_t numberOfIndices{0u};
+
+    do
+    {
+        // we are empty if next points to an element with index of Size
+        if (oldHead.indexToNextFreeIndex >= m_size)
+        {
+            return 0u;
+        }
+
+        /// walk along the list; if another thread modifies the list in between the aba counter of the head
+        /// changes and the compare-and-swap fails, therefore the walk is only used when the list was stable
+        uint32_t lastIndex = oldHead.indexToNextFreeIndex;
+        numberOfIndices = 1u;
+        while (numberOfIndices < maxNumberOfIndices)
+        {
+            uint32_t nextIndex = m_nextFreeIndex[lastIndex];
+            if (nextIndex >= m_size)
+            {
+                break;
+            }
+            lastIndex = nextIndex;
+            ++numberOfIndices;
+        }
+
+        newHead.indexToNextFreeIndex = m_nextFreeIndex[lastIndex];
+        newHead.abaCounter = oldHead.abaCounter + 1;
+    } while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    /// the detached elements are owned by this thread now, see pop of a single element
+    uint32_t index = oldHead.indexToNextFreeIndex;
+    for (uint32_t i = 0u; i < numberOfIndices; ++i)
+    {
+        indices[i] = index;
+        uint32_t nextIndex = m_nextFreeIndex[index];
+        m_nextFreeIndex[index] = m_invalidIndex;
+        index = nextIndex;
+    }
+
+    /// we need to synchronize m_nextFreeIndex with push so that we can perform a validation
+    /// check right before push to avoid double free's
+    std::atomic_thread_fence(std::memory_order_release);
+
+    return numberOfIndices;
+}
+
+bool LoFFLi::push(const uint32_t* const indices, const uint32_t numberOfIndices)
+{
+    if (numberOfIndices == 0u)
+    {
+        return true;
+    }
+
+    /// the validity check reads m_nextFreeIndex after this fence, therefore an acquire fence is required to
+    /// synchronize with the release fence at the end of pop
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    /// chain the elements before they are published; an index which occurs twice is detected since its
+    /// m_nextFreeIndex is already overwritten when it is checked the second time
+    for (uint32_t i = 0u; i < numberOfIndices; ++i)
+    {
+        const uint32_t index = indices[i];
+        if (index >= m_size || m_nextFreeIndex[index] != m_invalidIndex)
+        {
+            for (uint32_t k = 0u; k < i; ++k)
+            {
+                m_nextFreeIndex[indices[k]] = m_invalidIndex;
+            }
+            return false;
+        }
+        m_nextFreeIndex[index] = (i + 1u < numberOfIndices) ? indices[i + 1u] : m_size;
+    }
+
+    const uint32_t lastIndex = indices[numberOfIndices - 1u];
+    Node oldHead = m_head.load(std::memory_order_acquire);
+    Node newHead = oldHead;
+
+    do
+    {
+        m_nextFreeIndex[lastIndex] = oldHead.indexToNextFreeIndex;
+        newHead.indexToNextFreeIndex = indices[0u];
+        newHead.abaCounter = oldHead.abaCounter + 1;
+    } while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    return true;
+}
+
 } // namespace concurrent
 } // namespace iox
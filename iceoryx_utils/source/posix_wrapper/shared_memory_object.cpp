@@ -15,9 +15,11 @@
 #include "iceoryx_utils/internal/posix_wrapper/shared_memory_object.hpp"
 #include "iceoryx_utils/cxx/helplets.hpp"
 #include "iceoryx_utils/cxx/smart_c.hpp"
+#include "iceoryx_utils/internal/posix_wrapper/system_configuration.hpp"
 #include "iceoryx_utils/platform/fcntl.hpp"
 #include "iceoryx_utils/platform/unistd.hpp"
 
+#include <chrono>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
@@ -31,10 +33,21 @@ cxx::optional<SharedMemoryObject> SharedMemoryObject::create(const char* f_name,
                                                              const AccessMode f_accessMode,
                                                              const OwnerShip f_ownerShip,
                                                              const void* f_baseAddressHint,
-                                                             const mode_t f_permissions)
+                                                             const mode_t f_permissions,
+                                                             const PageType f_pageType,
+                                                             const PageFaultPolicy f_pageFaultPolicy,
+                                                             const uint32_t f_numaNode)
 {
     cxx::optional<SharedMemoryObject> returnValue;
-    returnValue.emplace(f_name, f_memorySizeInBytes, f_accessMode, f_ownerShip, f_baseAddressHint, f_permissions);
+    returnValue.emplace(f_name,
+                        f_memorySizeInBytes,
+                        f_accessMode,
+                        f_ownerShip,
+                        f_baseAddressHint,
+                        f_permissions,
+                        f_pageType,
+                        f_pageFaultPolicy,
+                        f_numaNode);
 
     if (returnValue->isInitialized())
     {
@@ -51,8 +64,15 @@ SharedMemoryObject::SharedMemoryObject(const char* f_name,
                                        const AccessMode f_accessMode,
                                        const OwnerShip f_ownerShip,
                                        const void* f_baseAddressHint,
-                                       const mode_t f_permissions)
-    : m_memorySizeInBytes(cxx::align(f_memorySizeInBytes, Allocator::MEMORY_ALIGNMENT))
+                                       const mode_t f_permissions,
+                                       const PageType f_pageType,
+                                       const PageFaultPolicy f_pageFaultPolicy,
+                                       const uint32_t f_numaNode)
+    // with huge pages the size is a multiple of the huge page size, this way the end of the memory is not backed by
+    // normal pages
+    : m_memorySizeInBytes(cxx::align(f_memorySizeInBytes,
+                                     (f_pageType == PageType::huge) ? MemoryMap::HUGE_PAGE_SIZE
+                                                                    : Allocator::MEMORY_ALIGNMENT))
     , m_sharedMemory(f_name, f_accessMode, f_ownerShip, f_permissions, m_memorySizeInBytes)
 {
     if (!m_sharedMemory.isInitialized())
@@ -63,8 +83,22 @@ SharedMemoryObject::SharedMemoryObject(const char* f_name,
         return;
     }
 
+    const bool useHugePages = (f_pageType == PageType::huge) && hugePagesAvailableForSharedMemory();
+    if (f_pageType == PageType::huge && !useHugePages)
+    {
+        std::clog << "Huge pages are not available for the shared memory [" << f_name
+                  << "] since /dev/shm is not mounted with huge=advise, huge=always or huge=within_size and "
+                     "/sys/kernel/mm/transparent_hugepage/shmem_enabled is not force, falling back to normal pages"
+                  << std::endl;
+    }
+
+    // a huge page is only used if the mapping covers it completely, therefore the mapping starts at a huge page
+    // boundary unless the caller requires a specific address
+    const void* baseAddressHint = (useHugePages && f_baseAddressHint == nullptr)
+                                      ? MemoryMap::hugePageAlignedAddressHint(m_memorySizeInBytes)
+                                      : f_baseAddressHint;
     m_memoryMap = MemoryMap::create(
-        f_baseAddressHint, m_memorySizeInBytes, m_sharedMemory.getHandle(), f_accessMode, MAP_SHARED, 0);
+        baseAddressHint, m_memorySizeInBytes, m_sharedMemory.getHandle(), f_accessMode, MAP_SHARED, 0);
 
     if (!m_memoryMap.has_value())
     {
@@ -73,9 +107,25 @@ SharedMemoryObject::SharedMemoryObject(const char* f_name,
         m_isInitialized = false;
         return;
     }
+
+    if (useHugePages && !m_memoryMap->adviseHugePages())
+    {
+        std::clog << "Huge pages are not available for the shared memory [" << f_name
+                  << "], falling back to normal pages" << std::endl;
+    }
+
+    if (f_ownerShip == OwnerShip::mine && f_numaNode != MemoryMap::ANY_NUMA_NODE
+        && !m_memoryMap->bindToNumaNode(f_numaNode))
+    {
+        std::clog << "The shared memory [" << f_name << "] could not be bound to NUMA node " << f_numaNode
+                  << ", the default memory policy is used" << std::endl;
+    }
+
     m_allocator.emplace(m_memoryMap->getBaseAddress(), m_memorySizeInBytes);
     m_isInitialized = true;
 
+    auto start = std::chrono::steady_clock::now();
+
     if (f_ownerShip == OwnerShip::mine && m_isInitialized)
     {
         std::clog << "Reserving " << m_memorySizeInBytes << " bytes in the shared memory [" << f_name << "]"
@@ -83,6 +133,27 @@ SharedMemoryObject::SharedMemoryObject(const char* f_name,
         memset(m_memoryMap->getBaseAddress(), 0, m_memorySizeInBytes);
         std::clog << "[ Reserving shared memory successful ] " << std::endl;
     }
+    // the memset already touched every page of the owner
+    else if (f_pageFaultPolicy != PageFaultPolicy::onDemand)
+    {
+        m_memoryMap->prefault();
+    }
+
+    if (f_pageFaultPolicy == PageFaultPolicy::lock && !m_memoryMap->lock())
+    {
+        std::clog << "Unable to lock the shared memory [" << f_name << "] into RAM, the pages can be swapped out"
+                  << std::endl;
+    }
+
+    // the owner touches every page with the memset, but only a requested prefault is reported as such
+    if (f_pageFaultPolicy != PageFaultPolicy::onDemand)
+    {
+        auto duration =
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        std::clog << "Prefaulting" << (m_memoryMap->isLocked() ? " and locking " : " ") << m_memorySizeInBytes
+                  << " bytes of the shared memory [" << f_name << "] took " << duration.count() << " us"
+                  << std::endl;
+    }
 }
 
 void* SharedMemoryObject::allocate(const uint64_t f_size, const uint64_t f_alignment)
@@ -13,12 +13,22 @@
 // limitations under the License.
 
 #include "iceoryx_utils/internal/posix_wrapper/shared_memory_object/memory_map.hpp"
+#include "iceoryx_utils/cxx/helplets.hpp"
 #include "iceoryx_utils/cxx/smart_c.hpp"
+#include "iceoryx_utils/internal/posix_wrapper/system_configuration.hpp"
+#include "iceoryx_utils/platform/unistd.hpp"
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
 
 namespace iox
 {
 namespace posix
 {
+constexpr uint64_t MemoryMap::HUGE_PAGE_SIZE;
+constexpr uint32_t MemoryMap::ANY_NUMA_NODE;
+
 cxx::optional<MemoryMap> MemoryMap::create(const void* f_baseAddressHint,
                                            const uint64_t f_length,
                                            const int32_t f_fileDescriptor,
@@ -115,8 +125,10 @@ MemoryMap& MemoryMap::operator=(MemoryMap&& rhs)
         m_isInitialized = std::move(rhs.m_isInitialized);
         m_baseAddress = std::move(rhs.m_baseAddress);
         m_length = std::move(rhs.m_length);
+        m_isLocked = std::move(rhs.m_isLocked);
 
         rhs.m_isInitialized = false;
+        rhs.m_isLocked = false;
     }
     return *this;
 }
@@ -138,5 +150,129 @@ void* MemoryMap::getBaseAddress() const
 {
     return m_baseAddress;
 }
+
+void* MemoryMap::hugePageAlignedAddressHint(const uint64_t f_length)
+{
+#if defined(MAP_ANONYMOUS) && defined(PROT_NONE)
+    // reserve an address range with room for the alignment and release it again, the kernel places the following
+    // mapping at the hint as long as no other mapping was created in between
+    auto reserveCall = cxx::makeSmartC(static_cast<void* (*)(void*, size_t, int, int, int, off_t)>(mmap),
+                                       cxx::ReturnMode::PRE_DEFINED_ERROR_CODE,
+                                       {reinterpret_cast<void*>(MAP_FAILED)},
+                                       {},
+                                       nullptr,
+                                       f_length + HUGE_PAGE_SIZE,
+                                       PROT_NONE,
+                                       MAP_PRIVATE | MAP_ANONYMOUS,
+                                       -1,
+                                       0);
+    if (reserveCall.hasErrors())
+    {
+        return nullptr;
+    }
+
+    void* reservedAddress = reserveCall.getReturnValue();
+    cxx::makeSmartC(
+        munmap, cxx::ReturnMode::PRE_DEFINED_ERROR_CODE, {-1}, {}, reservedAddress, f_length + HUGE_PAGE_SIZE);
+    return reinterpret_cast<void*>(cxx::align(reinterpret_cast<uint64_t>(reservedAddress), HUGE_PAGE_SIZE));
+#else
+    return nullptr;
+#endif
+}
+
+bool MemoryMap::adviseHugePages()
+{
+#if defined(MADV_HUGEPAGE)
+    auto madviseCall = cxx::makeSmartC(
+        madvise, cxx::ReturnMode::PRE_DEFINED_ERROR_CODE, {-1}, {}, m_baseAddress, m_length, MADV_HUGEPAGE);
+    if (madviseCall.hasErrors())
+    {
+        std::cerr << "Unable to advise huge pages for the memory mapping : " << madviseCall.getErrorString()
+                  << std::endl;
+        return false;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool MemoryMap::bindToNumaNode(const uint32_t f_numaNode)
+{
+#if defined(__linux__) && defined(SYS_mbind)
+    // the syscall is used directly since libnuma is not necessarily available; MPOL_BIND from numaif.h
+    constexpr int32_t MPOL_BIND_MODE{2};
+    constexpr uint64_t BITS_PER_MASK_ENTRY{sizeof(unsigned long) * 8u};
+    constexpr uint32_t MAX_NUMA_NODES{1024u};
+
+    if (f_numaNode >= MAX_NUMA_NODES)
+    {
+        std::cerr << "Unable to bind the memory mapping to NUMA node " << f_numaNode << " : node does not exist"
+                  << std::endl;
+        return false;
+    }
+
+    unsigned long nodeMask[MAX_NUMA_NODES / BITS_PER_MASK_ENTRY]{0u};
+    nodeMask[f_numaNode / BITS_PER_MASK_ENTRY] = 1ul << (f_numaNode % BITS_PER_MASK_ENTRY);
+
+    auto mbindCall = cxx::makeSmartC(syscall,
+                                     cxx::ReturnMode::PRE_DEFINED_ERROR_CODE,
+                                     {-1l},
+                                     {},
+                                     SYS_mbind,
+                                     m_baseAddress,
+                                     m_length,
+                                     MPOL_BIND_MODE,
+                                     nodeMask,
+                                     static_cast<unsigned long>(MAX_NUMA_NODES),
+                                     0u);
+    if (mbindCall.hasErrors())
+    {
+        std::cerr << "Unable to bind the memory mapping to NUMA node " << f_numaNode << " : "
+                  << mbindCall.getErrorString() << std::endl;
+        return false;
+    }
+    return true;
+#else
+    static_cast<void>(f_numaNode);
+    return false;
+#endif
+}
+
+bool MemoryMap::prefault()
+{
+    auto pageSize = posix::pageSize();
+    if (!pageSize.has_value())
+    {
+        std::cerr << "Unable to prefault the memory mapping since the page size is unknown" << std::endl;
+        return false;
+    }
+
+    // reading one byte per page is sufficient to map it, this works also for read only mappings
+    auto memory = static_cast<volatile uint8_t*>(m_baseAddress);
+    for (uint64_t offset = 0u; offset < m_length; offset += pageSize.value())
+    {
+        static_cast<void>(memory[offset]);
+    }
+    return true;
+}
+
+bool MemoryMap::lock()
+{
+    auto mlockCall =
+        cxx::makeSmartC(mlock, cxx::ReturnMode::PRE_DEFINED_ERROR_CODE, {-1}, {}, m_baseAddress, m_length);
+    if (mlockCall.hasErrors())
+    {
+        std::cerr << "Unable to lock the memory mapping : " << mlockCall.getErrorString() << std::endl;
+        return false;
+    }
+    m_isLocked = true;
+    return true;
+}
+
+bool MemoryMap::isLocked() const
+{
+    return m_isLocked;
+}
 } // namespace posix
 } // namespace iox
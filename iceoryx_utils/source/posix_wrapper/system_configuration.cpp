@@ -15,6 +15,13 @@
 #include "iceoryx_utils/internal/posix_wrapper/system_configuration.hpp"
 
 #include "iceoryx_utils/cxx/smart_c.hpp"
+#include "iceoryx_utils/internal/file_reader/file_reader.hpp"
+
+#include <string>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
 
 namespace iox
 {
@@ -30,5 +37,97 @@ cxx::optional<uint64_t> pageSize()
 
     return cxx::make_optional<uint64_t>(size.getReturnValue());
 }
+
+cxx::optional<uint32_t> numaNodeOfCurrentThread()
+{
+#if defined(__linux__) && defined(SYS_getcpu)
+    uint32_t cpu{0u};
+    uint32_t node{0u};
+    auto getcpuCall = makeSmartC(syscall,
+                                 cxx::ReturnMode::PRE_DEFINED_ERROR_CODE,
+                                 {-1l},
+                                 {},
+                                 SYS_getcpu,
+                                 &cpu,
+                                 &node,
+                                 static_cast<void*>(nullptr));
+    if (getcpuCall.hasErrors())
+    {
+        return cxx::nullopt_t();
+    }
+
+    return cxx::make_optional<uint32_t>(node);
+#else
+    return cxx::nullopt_t();
+#endif
+}
+
+namespace
+{
+/// @brief returns the selected value of a sysfs setting like "always within_size advise [never] deny force"
+std::string selectedSysfsValue(const std::string& f_fileName)
+{
+    cxx::FileReader file(f_fileName, "", cxx::FileReader::ErrorMode::Ignore);
+    std::string line;
+    if (!file.IsOpen() || !file.ReadLine(line))
+    {
+        return "";
+    }
+
+    auto begin = line.find('[');
+    auto end = line.find(']');
+    if (begin == std::string::npos || end == std::string::npos || end < begin)
+    {
+        return "";
+    }
+    return line.substr(begin + 1u, end - begin - 1u);
+}
+
+/// @brief returns the value of the "huge" mount option of the given mount point or an empty string
+std::string hugeMountOption(const std::string& f_mountPoint)
+{
+    cxx::FileReader mounts("/proc/mounts", "", cxx::FileReader::ErrorMode::Ignore);
+    const std::string mountPointEntry = " " + f_mountPoint + " ";
+    const std::string hugeOption = "huge=";
+    std::string line;
+    std::string value;
+    while (mounts.IsOpen() && mounts.ReadLine(line))
+    {
+        if (line.find(mountPointEntry) == std::string::npos)
+        {
+            continue;
+        }
+        // the last mount on the mount point is the visible one
+        value.clear();
+        auto option = line.find(hugeOption);
+        if (option != std::string::npos)
+        {
+            option += hugeOption.size();
+            value = line.substr(option, line.find_first_of(", ", option) - option);
+        }
+    }
+    return value;
+}
+} // namespace
+
+bool hugePagesAvailableForSharedMemory()
+{
+#if defined(__linux__)
+    const std::string shmemEnabled = selectedSysfsValue("/sys/kernel/mm/transparent_hugepage/shmem_enabled");
+    if (shmemEnabled == "force")
+    {
+        return true;
+    }
+    if (shmemEnabled == "deny")
+    {
+        return false;
+    }
+
+    const std::string hugeOption = hugeMountOption("/dev/shm");
+    return hugeOption == "advise" || hugeOption == "always" || hugeOption == "within_size";
+#else
+    return false;
+#endif
+}
 } // namespace posix
 } // namespace iox
@@ -16,7 +16,9 @@
 #include "test.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <random>
+#include <thread>
 #include <vector>
 
 using namespace ::testing;
@@ -194,3 +196,176 @@ TYPED_TEST(LoFFLi_test, PushToUninitializedLoFFLi)
     decltype(this->m_loffli) loFFLi;
     EXPECT_THAT(loFFLi.push(0), Eq(false));
 }
+
+TYPED_TEST(LoFFLi_test, MultiPopReturnsAllIndicesInOrder)
+{
+    uint32_t indices[Size];
+    EXPECT_THAT(this->m_loffli.pop(indices, Size), Eq(Size));
+    for (uint32_t i = 0; i < Size; i++)
+    {
+        EXPECT_THAT(indices[i], Eq(i));
+    }
+
+    uint32_t index;
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(false));
+}
+
+TYPED_TEST(LoFFLi_test, MultiPopStopsWhenEmpty)
+{
+    uint32_t index;
+    this->m_loffli.pop(index);
+
+    uint32_t indices[Size + 2];
+    EXPECT_THAT(this->m_loffli.pop(indices, Size + 2), Eq(Size - 1));
+    EXPECT_THAT(this->m_loffli.pop(indices, Size + 2), Eq(0u));
+}
+
+TYPED_TEST(LoFFLi_test, MultiPopWithZeroIndices)
+{
+    uint32_t indices[1];
+    EXPECT_THAT(this->m_loffli.pop(indices, 0), Eq(0u));
+
+    uint32_t index;
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(true));
+    EXPECT_THAT(index, Eq(0u));
+}
+
+TYPED_TEST(LoFFLi_test, MultiPopFromUninitializedLoFFLi)
+{
+    uint32_t indices[Size];
+    decltype(this->m_loffli) loFFLi;
+    EXPECT_THAT(loFFLi.pop(indices, Size), Eq(0u));
+}
+
+TYPED_TEST(LoFFLi_test, MultiPushMakesIndicesAvailableAgain)
+{
+    uint32_t indices[Size];
+    ASSERT_THAT(this->m_loffli.pop(indices, Size), Eq(Size));
+
+    std::reverse(indices, indices + Size);
+    EXPECT_THAT(this->m_loffli.push(indices, Size), Eq(true));
+
+    std::vector<uint32_t> useListPoped;
+    uint32_t index;
+    while (this->m_loffli.pop(index))
+    {
+        useListPoped.push_back(index);
+    }
+
+    EXPECT_THAT(useListPoped, Eq(std::vector<uint32_t>(indices, indices + Size)));
+}
+
+TYPED_TEST(LoFFLi_test, MultiPushPartOfPopedIndices)
+{
+    uint32_t indices[Size];
+    ASSERT_THAT(this->m_loffli.pop(indices, Size), Eq(Size));
+
+    EXPECT_THAT(this->m_loffli.push(indices + 1, 2), Eq(true));
+
+    uint32_t popedIndices[Size];
+    EXPECT_THAT(this->m_loffli.pop(popedIndices, Size), Eq(2u));
+    EXPECT_THAT(popedIndices[0], Eq(indices[1]));
+    EXPECT_THAT(popedIndices[1], Eq(indices[2]));
+}
+
+TYPED_TEST(LoFFLi_test, MultiPushWithDuplicateIndexFailsAndPushesNothing)
+{
+    uint32_t indices[Size];
+    ASSERT_THAT(this->m_loffli.pop(indices, Size), Eq(Size));
+
+    uint32_t indicesToPush[3] = {indices[0], indices[1], indices[0]};
+    EXPECT_THAT(this->m_loffli.push(indicesToPush, 3), Eq(false));
+
+    uint32_t index;
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(false));
+    EXPECT_THAT(this->m_loffli.push(indices, Size), Eq(true));
+}
+
+TYPED_TEST(LoFFLi_test, MultiPushWithNotPopedIndexFailsAndPushesNothing)
+{
+    uint32_t indices[2];
+    ASSERT_THAT(this->m_loffli.pop(indices, 2), Eq(2u));
+
+    uint32_t indicesToPush[3] = {indices[0], indices[1], Size - 1};
+    EXPECT_THAT(this->m_loffli.push(indicesToPush, 3), Eq(false));
+    EXPECT_THAT(this->m_loffli.push(indicesToPush, 2), Eq(true));
+}
+
+TYPED_TEST(LoFFLi_test, MultiPushOutOfBoundIndex)
+{
+    uint32_t indices[2];
+    ASSERT_THAT(this->m_loffli.pop(indices, 2), Eq(2u));
+
+    uint32_t indicesToPush[2] = {indices[0], Size + 42};
+    EXPECT_THAT(this->m_loffli.push(indicesToPush, 2), Eq(false));
+}
+
+TYPED_TEST(LoFFLi_test, ConcurrentMultiPopAndMultiPushNeitherLoseNorDuplicateIndices)
+{
+    constexpr uint32_t NUMBER_OF_INDICES{128u};
+    constexpr uint32_t NUMBER_OF_THREADS{4u};
+    constexpr uint32_t NUMBER_OF_ITERATIONS{20000u};
+    constexpr uint32_t MAX_BATCH_SIZE{8u};
+
+    std::vector<uint32_t> memory(TypeParam::requiredMemorySize(NUMBER_OF_INDICES));
+    TypeParam sut;
+    sut.init(memory.data(), NUMBER_OF_INDICES);
+
+    std::vector<std::atomic<uint32_t>> owners(NUMBER_OF_INDICES);
+    for (auto& owner : owners)
+    {
+        owner.store(0u);
+    }
+    std::atomic<uint32_t> numberOfDuplicates{0u};
+    std::atomic<uint32_t> numberOfFailedPushes{0u};
+
+    auto worker = [&](const uint32_t seed) {
+        std::mt19937 generator(seed);
+        std::uniform_int_distribution<uint32_t> batchSize(1u, MAX_BATCH_SIZE);
+        uint32_t indices[MAX_BATCH_SIZE];
+        for (uint32_t i = 0u; i < NUMBER_OF_ITERATIONS; ++i)
+        {
+            const uint32_t numberOfIndices = sut.pop(indices, batchSize(generator));
+            for (uint32_t k = 0u; k < numberOfIndices; ++k)
+            {
+                if (owners[indices[k]].fetch_add(1u) != 0u)
+                {
+                    ++numberOfDuplicates;
+                }
+            }
+            for (uint32_t k = 0u; k < numberOfIndices; ++k)
+            {
+                owners[indices[k]].fetch_sub(1u);
+            }
+            if (numberOfIndices > 0u && !sut.push(indices, numberOfIndices))
+            {
+                ++numberOfFailedPushes;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0u; i < NUMBER_OF_THREADS; ++i)
+    {
+        threads.emplace_back(worker, i);
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_THAT(numberOfDuplicates.load(), Eq(0u));
+    EXPECT_THAT(numberOfFailedPushes.load(), Eq(0u));
+
+    std::vector<bool> seen(NUMBER_OF_INDICES, false);
+    uint32_t index{0u};
+    uint32_t numberOfPopedIndices{0u};
+    while (sut.pop(index))
+    {
+        ASSERT_THAT(index, Lt(NUMBER_OF_INDICES));
+        EXPECT_FALSE(seen[index]);
+        seen[index] = true;
+        ++numberOfPopedIndices;
+    }
+    EXPECT_THAT(numberOfPopedIndices, Eq(NUMBER_OF_INDICES));
+}
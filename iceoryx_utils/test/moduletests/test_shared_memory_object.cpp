@@ -14,8 +14,13 @@
 
 #include "iceoryx_utils/cxx/helplets.hpp"
 #include "iceoryx_utils/internal/posix_wrapper/shared_memory_object.hpp"
+#include "iceoryx_utils/internal/posix_wrapper/system_configuration.hpp"
 #include "test.hpp"
 
+#include <fstream>
+#include <sstream>
+#include <string>
+
 using namespace testing;
 using namespace iox;
 
@@ -142,3 +147,174 @@ TEST_F(SharedMemoryObject_Test, OpeningSharedMemoryAndReadMultipleContents)
     EXPECT_THAT(*sutValue1, Eq(4557));
     EXPECT_THAT(*sutValue2, Eq(8912));
 }
+
+TEST_F(SharedMemoryObject_Test, CTorWithHugePagesAlignsSizeToHugePageSize)
+{
+    auto sut = iox::posix::SharedMemoryObject::create("/shmHugePages",
+                                                      100,
+                                                      iox::posix::AccessMode::readWrite,
+                                                      iox::posix::OwnerShip::mine,
+                                                      nullptr,
+                                                      S_IRUSR | S_IWUSR,
+                                                      iox::posix::PageType::huge);
+    ASSERT_THAT(sut.has_value(), Eq(true));
+    EXPECT_THAT(sut->getSizeInBytes(), Eq(iox::posix::MemoryMap::HUGE_PAGE_SIZE));
+}
+
+/// @brief returns the size of the memory which is mapped with huge pages in the mapping which starts at the given
+/// address according to /proc/self/smaps
+uint64_t hugePageMappedSizeInKiloBytes(const void* const baseAddress)
+{
+    std::stringstream mappingStart;
+    mappingStart << std::hex << reinterpret_cast<uint64_t>(baseAddress) << "-";
+
+    std::ifstream smaps("/proc/self/smaps");
+    std::string line;
+    bool isInMapping{false};
+    while (std::getline(smaps, line))
+    {
+        if (line.find('-') != std::string::npos && line.find(':') > line.find(' '))
+        {
+            isInMapping = (line.find(mappingStart.str()) == 0u);
+        }
+        else if (isInMapping && line.find("ShmemPmdMapped:") == 0u)
+        {
+            return std::stoull(line.substr(line.find(':') + 1u));
+        }
+    }
+    return 0u;
+}
+
+TEST_F(SharedMemoryObject_Test, CTorWithHugePagesIsBackedByHugePagesOrReportsFallback)
+{
+    std::stringstream clogOutput;
+    auto clogBuffer = std::clog.rdbuf(clogOutput.rdbuf());
+    auto sut = iox::posix::SharedMemoryObject::create("/shmHugePagesBacking",
+                                                      iox::posix::MemoryMap::HUGE_PAGE_SIZE,
+                                                      iox::posix::AccessMode::readWrite,
+                                                      iox::posix::OwnerShip::mine,
+                                                      nullptr,
+                                                      S_IRUSR | S_IWUSR,
+                                                      iox::posix::PageType::huge);
+    std::clog.rdbuf(clogBuffer);
+    ASSERT_THAT(sut.has_value(), Eq(true));
+
+    if (iox::posix::hugePagesAvailableForSharedMemory())
+    {
+        EXPECT_THAT(reinterpret_cast<uint64_t>(sut->getBaseAddress()) % iox::posix::MemoryMap::HUGE_PAGE_SIZE, Eq(0u));
+        EXPECT_THAT(hugePageMappedSizeInKiloBytes(sut->getBaseAddress()),
+                    Eq(iox::posix::MemoryMap::HUGE_PAGE_SIZE / 1024u));
+    }
+    else
+    {
+        EXPECT_THAT(clogOutput.str(), HasSubstr("falling back to normal pages"));
+    }
+}
+
+TEST_F(SharedMemoryObject_Test, OpeningSharedMemoryWithHugePagesAndReadContent)
+{
+    auto shmMemory = iox::posix::SharedMemoryObject::create("/shmHugePagesSut",
+                                                            100,
+                                                            iox::posix::AccessMode::readWrite,
+                                                            iox::posix::OwnerShip::mine,
+                                                            nullptr,
+                                                            S_IRUSR | S_IWUSR,
+                                                            iox::posix::PageType::huge);
+    ASSERT_THAT(shmMemory.has_value(), Eq(true));
+    int* test = static_cast<int*>(shmMemory->allocate(sizeof(int), 1));
+    *test = 1337;
+
+    auto sut = iox::posix::SharedMemoryObject::create("/shmHugePagesSut",
+                                                      shmMemory->getSizeInBytes(),
+                                                      iox::posix::AccessMode::readWrite,
+                                                      iox::posix::OwnerShip::openExisting,
+                                                      nullptr,
+                                                      S_IRUSR | S_IWUSR,
+                                                      iox::posix::PageType::huge);
+    ASSERT_THAT(sut.has_value(), Eq(true));
+    int* sutValue = static_cast<int*>(sut->allocate(sizeof(int), 1));
+    EXPECT_THAT(*sutValue, Eq(1337));
+}
+
+TEST_F(SharedMemoryObject_Test, CTorReportsPrefaultingOnlyIfItWasRequested)
+{
+    for (auto pageFaultPolicy : {iox::posix::PageFaultPolicy::onDemand, iox::posix::PageFaultPolicy::prefault})
+    {
+        std::stringstream clogOutput;
+        auto clogBuffer = std::clog.rdbuf(clogOutput.rdbuf());
+        auto sut = iox::posix::SharedMemoryObject::create("/shmPrefaultReport",
+                                                          100,
+                                                          iox::posix::AccessMode::readWrite,
+                                                          iox::posix::OwnerShip::mine,
+                                                          nullptr,
+                                                          S_IRUSR | S_IWUSR,
+                                                          iox::posix::PageType::normal,
+                                                          pageFaultPolicy);
+        std::clog.rdbuf(clogBuffer);
+        ASSERT_THAT(sut.has_value(), Eq(true));
+
+        bool isPrefaultingReported = clogOutput.str().find("Prefaulting") != std::string::npos;
+        EXPECT_THAT(isPrefaultingReported, Eq(pageFaultPolicy != iox::posix::PageFaultPolicy::onDemand));
+    }
+}
+
+TEST_F(SharedMemoryObject_Test, OpeningSharedMemoryWithPrefaultAndReadContent)
+{
+    auto shmMemory = iox::posix::SharedMemoryObject::create("/shmPrefaultSut",
+                                                            100,
+                                                            iox::posix::AccessMode::readWrite,
+                                                            iox::posix::OwnerShip::mine,
+                                                            nullptr,
+                                                            S_IRUSR | S_IWUSR,
+                                                            iox::posix::PageType::normal,
+                                                            iox::posix::PageFaultPolicy::prefault);
+    ASSERT_THAT(shmMemory.has_value(), Eq(true));
+    int* test = static_cast<int*>(shmMemory->allocate(sizeof(int), 1));
+    *test = 1337;
+
+    auto sut = iox::posix::SharedMemoryObject::create("/shmPrefaultSut",
+                                                      100,
+                                                      iox::posix::AccessMode::readOnly,
+                                                      iox::posix::OwnerShip::openExisting,
+                                                      nullptr,
+                                                      S_IRUSR | S_IWUSR,
+                                                      iox::posix::PageType::normal,
+                                                      iox::posix::PageFaultPolicy::prefault);
+    ASSERT_THAT(sut.has_value(), Eq(true));
+    int* sutValue = static_cast<int*>(sut->allocate(sizeof(int), 1));
+    EXPECT_THAT(*sutValue, Eq(1337));
+}
+
+TEST_F(SharedMemoryObject_Test, CTorWithLockedPagesSucceedsEvenIfLockingIsNotPermitted)
+{
+    auto sut = iox::posix::SharedMemoryObject::create("/shmLockedPages",
+                                                      100,
+                                                      iox::posix::AccessMode::readWrite,
+                                                      iox::posix::OwnerShip::mine,
+                                                      nullptr,
+                                                      S_IRUSR | S_IWUSR,
+                                                      iox::posix::PageType::normal,
+                                                      iox::posix::PageFaultPolicy::lock);
+    ASSERT_THAT(sut.has_value(), Eq(true));
+    int* sutValue = static_cast<int*>(sut->allocate(sizeof(int), 1));
+    *sutValue = 42;
+    EXPECT_THAT(*sutValue, Eq(42));
+}
+
+TEST_F(SharedMemoryObject_Test, CTorWithNumaNodeOfCurrentThreadSucceeds)
+{
+    auto numaNode = iox::posix::numaNodeOfCurrentThread().value_or(0u);
+    auto sut = iox::posix::SharedMemoryObject::create("/shmNumaNode",
+                                                      100,
+                                                      iox::posix::AccessMode::readWrite,
+                                                      iox::posix::OwnerShip::mine,
+                                                      nullptr,
+                                                      S_IRUSR | S_IWUSR,
+                                                      iox::posix::PageType::normal,
+                                                      iox::posix::PageFaultPolicy::onDemand,
+                                                      numaNode);
+    ASSERT_THAT(sut.has_value(), Eq(true));
+    int* sutValue = static_cast<int*>(sut->allocate(sizeof(int), 1));
+    *sutValue = 42;
+    EXPECT_THAT(*sutValue, Eq(42));
+}
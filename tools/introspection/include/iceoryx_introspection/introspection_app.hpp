@@ -35,6 +35,7 @@ static constexpr option longOptions[] = {{"help", no_argument, nullptr, 'h'},
                                          {"port", no_argument, nullptr, 0},
                                          {"process", no_argument, nullptr, 0},
                                          {"all", no_argument, nullptr, 0},
+                                         {"mempool-layout", required_argument, nullptr, 0},
                                          {nullptr, 0, nullptr, 0}};
 
 static constexpr const char* shortOptions = "hvt:";
@@ -87,6 +88,11 @@ class IntrospectionApp
 
     bool doIntrospection = false;
 
+    bool doMemPoolLayout = false;
+
+    /// @brief additional chunks in percent of the recorded peak usage for the suggested mempool layout
+    uint32_t memPoolLayoutHeadroomPercent{0u};
+
     /// @brief this is needed for the child classes to extend the parseCmdLineArguments function
     IntrospectionApp() noexcept;
 
@@ -98,6 +104,11 @@ class IntrospectionApp
     void runIntrospection(const iox::units::Duration updatePeriodMs,
                           const IntrospectionSelection introspectionSelection);
 
+    /// @brief receives one mempool introspection sample and prints the suggested mempools of the user segments in
+    /// the format of the RouDi config file
+    /// @param[in] headroomPercent additional chunks in percent of the recorded peak usage
+    void runMemPoolLayout(const uint32_t headroomPercent);
+
   private:
     /// @brief initializes ncurses terminal
     void initTerminal();
@@ -27,7 +27,11 @@ IceOryxIntrospectionApp::IceOryxIntrospectionApp(int argc, char* argv[]) noexcep
 
 void IceOryxIntrospectionApp::run() noexcept
 {
-    if (doIntrospection)
+    if (doMemPoolLayout)
+    {
+        runMemPoolLayout(memPoolLayoutHeadroomPercent);
+    }
+    else if (doIntrospection)
     {
         runIntrospection(DEFAULT_UPDATE_PERIOD, introspectionSelection);
     }
@@ -14,12 +14,15 @@
 
 #include "iceoryx_introspection/introspection_app.hpp"
 #include "iceoryx_introspection/introspection_types.hpp"
+#include "iceoryx_posh/roudi/mempool_layout_tuner.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 #include "iceoryx_utils/internal/units/duration.hpp"
 #include "iceoryx_versions.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <iomanip>
+#include <iostream>
 #include <poll.h>
 #include <thread>
 
@@ -63,6 +66,10 @@ void IntrospectionApp::printHelp() noexcept
                  "  --mempool         Subscribe to mempool introspection data.\n"
                  "  --port            Subscribe to port introspection data.\n"
                  "  --process         Subscribe to process introspection data.\n"
+                 "\nMemPool layout:\n"
+                 "  --mempool-layout <headroom>\n"
+                 "                    Print mempools for the RouDi config file which fit the recorded\n"
+                 "                    usage, with <headroom> percent additional chunks, and exit.\n"
               << std::endl;
 }
 
@@ -126,6 +133,11 @@ void IntrospectionApp::parseCmdLineArguments(int argc,
                 introspectionSelection.mempool = true;
                 doIntrospection = true;
             }
+            else if (strcmp(longOptions[index].name, "mempool-layout") == 0)
+            {
+                memPoolLayoutHeadroomPercent = static_cast<uint32_t>(std::max(0, std::atoi(optarg)));
+                doMemPoolLayout = true;
+            }
 
             break;
 
@@ -135,7 +147,7 @@ void IntrospectionApp::parseCmdLineArguments(int argc,
             exit(EXIT_FAILURE);
         }
     }
-    if (!doIntrospection)
+    if (!doIntrospection && !doMemPoolLayout)
     {
         std::cout << "Wrong usage. ";
         printShortInfo(argv[0]);
@@ -262,6 +274,7 @@ void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspe
     constexpr int32_t usedchunksWidth{14};
     constexpr int32_t numchunksWidth{9};
     constexpr int32_t minFreechunksWidth{9};
+    constexpr int32_t stashedchunksWidth{8};
     constexpr int32_t chunkSizeWidth{11};
     constexpr int32_t payloadSizeWidth{13};
 
@@ -269,9 +282,10 @@ void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspe
     wprintw(pad, "%*s |", usedchunksWidth, "Chunks In Use");
     wprintw(pad, "%*s |", numchunksWidth, "Total");
     wprintw(pad, "%*s |", minFreechunksWidth, "Min Free");
+    wprintw(pad, "%*s |", stashedchunksWidth, "Stashed");
     wprintw(pad, "%*s |", chunkSizeWidth, "Chunk Size");
     wprintw(pad, "%*s\n", payloadSizeWidth, "Payload Size");
-    wprintw(pad, "--------------------------------------------------------------------------\n");
+    wprintw(pad, "------------------------------------------------------------------------------------\n");
 
     for (size_t i = 0u; i < introspectionInfo.m_mempoolInfo.size(); ++i)
     {
@@ -282,6 +296,7 @@ void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspe
             wprintw(pad, "%*d |", usedchunksWidth, info.m_usedChunks);
             wprintw(pad, "%*d |", numchunksWidth, info.m_numChunks);
             wprintw(pad, "%*d |", minFreechunksWidth, info.m_minFreeChunks);
+            wprintw(pad, "%*d |", stashedchunksWidth, info.m_stashedChunks);
             wprintw(pad, "%*d |", chunkSizeWidth, info.m_chunkSize);
             wprintw(pad, "%*d\n", payloadSizeWidth, info.m_payloadSize);
         }
@@ -603,6 +618,41 @@ IntrospectionApp::composeReceiverPortData(const PortIntrospectionFieldTopic* por
     return receiverPortData;
 }
 
+void IntrospectionApp::runMemPoolLayout(const uint32_t headroomPercent)
+{
+    iox::runtime::PoshRuntime::getInstance(iox::roudi::INTROSPECTION_MQ_APP_NAME);
+
+    SubscriberType memPoolSubscriber(IntrospectionMempoolService);
+    memPoolSubscriber.subscribe(1u);
+    if (waitForSubscription(memPoolSubscriber) == false)
+    {
+        std::cerr << "Timeout while waiting for subscription for mempool introspection data!" << std::endl;
+        return;
+    }
+
+    const void* rawMempoolSample{nullptr};
+    while (!rawMempoolSample)
+    {
+        memPoolSubscriber.getChunk(&rawMempoolSample);
+        std::this_thread::sleep_for(std::chrono::milliseconds(MIN_UPDATE_PERIOD.milliSeconds<int64_t>()));
+    }
+
+    const MemPoolIntrospectionInfoContainer* mempoolSample =
+        static_cast<const MemPoolIntrospectionInfoContainer*>(rawMempoolSample);
+    for (const auto& info : *mempoolSample)
+    {
+        // the segment with id 0 is the RouDi internal segment which is not part of the config file
+        if (info.m_id == 0u)
+        {
+            continue;
+        }
+        writeMemPoolLayout(std::cout, info, suggestMePooConfig(info, headroomPercent));
+        std::cout << std::endl;
+    }
+
+    memPoolSubscriber.releaseChunk(rawMempoolSample);
+}
+
 void IntrospectionApp::runIntrospection(const iox::units::Duration updatePeriodMs,
                                         const IntrospectionSelection introspectionSelection)
 {